@@ -7,7 +7,12 @@
 #pragma once
 
 #include "Type.h"
+#include <atomic>
 #include <cassert>
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
 #include <utility>
 #include <optional>
 #include <stdexcept>
@@ -18,22 +23,55 @@ namespace my_reflect::dynamic_refl {
 template <typename T>
 const Type* GetType();
 
+namespace detail {
+	// Per-type id cache. Constant-initialized to 0, so reading it needs no static guard.
+	template <typename T>
+	inline std::atomic<TypeId> type_id_cache{0};
+}
+
+// Id of T's reflected type; after the first call this is a single relaxed load
+template <typename T>
+TypeId GetTypeId() {
+	using RawType = std::remove_cv_t<std::remove_reference_t<T>>;
+	TypeId id = detail::type_id_cache<RawType>.load(std::memory_order_relaxed);
+	if (id == 0) {
+		id = GetType<RawType>()->GetId();
+		detail::type_id_cache<RawType>.store(id, std::memory_order_relaxed);
+	}
+	return id;
+}
+
 class Any final {
 public:
 	enum class storage_type {
 		Empty, Copy, Move, Ref, ConstRef
 	};
 
+	// Per-type operation table, one static constexpr instance per T (see any_vtable)
 	struct operations {
 		Any(*copy)(const Any&) = nullptr;
 		Any(*move)(Any&) = nullptr;
 		void(*destroy)(Any&) = nullptr;
+		// Moves an inline payload from src's buffer into dst's buffer
+		void(*relocate)(Any& dst, Any& src) = nullptr;
+		bool(*equal)(const Any&, const Any&) = nullptr;
+		size_t(*hash)(const Any&) = nullptr;
+		size_t size = 0;
+		size_t alignment = 0;
 	};
 
+	// Small-buffer optimization: owned payloads that fit here and can be
+	// moved without throwing are stored inline instead of on the heap
+	static constexpr size_t inline_size = 3 * sizeof(void*);
+	static constexpr size_t inline_align = alignof(void*);
+
 	const Type* typeInfo = nullptr;
 	void* payload = nullptr;
 	storage_type storageType = storage_type::Empty;
-	operations ops;
+	// Cached typeInfo->GetId(), so type checks are one integer compare
+	TypeId typeId = 0;
+	const operations* ops = nullptr;
+	alignas(inline_align) unsigned char buffer[inline_size];
 
 	Any() = default;
 	Any(const Any& other);
@@ -45,6 +83,12 @@ public:
 	bool empty() const;
 	const Type* type() const;
 	storage_type storage() const;
+	bool is_inline() const;
+
+	// Compare payloads with T's operator==; false if types differ or T has none
+	bool equals(const Any& other) const;
+	// Hash the payload with std::hash<T>; throws if T is not hashable
+	size_t hash() const;
 
 	// Invoke member function by name
 	template<typename... Args>
@@ -53,15 +97,76 @@ public:
 	// Invoke member function by index
 	template<typename... Args>
 	Any invoke(size_t funcIndex, Args&&... args);
+
+private:
+	// Destroy owned content and leave this Any empty
+	void reset() noexcept;
+	// Take over other's content, relocating an inline payload if needed
+	void steal(Any& other) noexcept;
 };
 
+// Whether T is stored in Any's inline buffer rather than on the heap
+template <typename T>
+constexpr bool is_inline_v = sizeof(T) <= Any::inline_size
+	&& alignof(T) <= Any::inline_align
+	&& std::is_nothrow_move_constructible_v<T>;
+
+namespace detail {
+	template <typename T, typename = void>
+	struct has_equal : std::false_type {};
+
+	template <typename T>
+	struct has_equal<T, std::void_t<decltype(std::declval<const T&>() == std::declval<const T&>())>>
+		: std::true_type {};
+
+	// std containers declare operator== unconstrained, so also check the elements
+	template <typename T, typename = void>
+	struct is_equality_comparable : has_equal<T> {};
+
+	template <typename T>
+	struct is_equality_comparable<T, std::void_t<typename T::value_type>>
+		: std::bool_constant<has_equal<T>::value && is_equality_comparable<typename T::value_type>::value> {};
+
+	template <typename A, typename B>
+	struct is_equality_comparable<std::pair<A, B>>
+		: std::bool_constant<is_equality_comparable<A>::value && is_equality_comparable<B>::value> {};
+
+	template <typename T, typename = void>
+	struct has_hash : std::false_type {};
+
+	template <typename T>
+	struct has_hash<T, std::void_t<decltype(std::hash<T>{}(std::declval<const T&>()))>>
+		: std::true_type {};
+}
+
 template <typename T>
 struct operations_traits {
+	// Construct an owned T for target, inline when it fits
+	template <typename... Args>
+	static T* construct(Any& target, Args&&... args) {
+		if constexpr (is_inline_v<T>) {
+			return new (target.buffer) T(std::forward<Args>(args)...);
+		} else {
+			return new T(std::forward<Args>(args)...);
+		}
+	}
+
+	// Construct an owned T for target from the prvalue factory() returns (no copy or move)
+	template <typename F>
+	static T* construct_with(Any& target, F&& factory) {
+		if constexpr (is_inline_v<T>) {
+			return new (target.buffer) T(std::forward<F>(factory)());
+		} else {
+			return new T(std::forward<F>(factory)());
+		}
+	}
+
 	static Any copy(const Any& elem) {
 		assert(elem.typeInfo == GetType<T>());
 		Any returnValue;
 		returnValue.typeInfo = elem.typeInfo;
-		returnValue.payload = new T(*static_cast<const T*>(elem.payload));
+		returnValue.typeId = elem.typeId;
+		returnValue.payload = construct(returnValue, *static_cast<const T*>(elem.payload));
 		returnValue.storageType = Any::storage_type::Copy;
 		returnValue.ops = elem.ops;
 		return returnValue;
@@ -71,55 +176,106 @@ struct operations_traits {
 		assert(elem.typeInfo == GetType<T>());
 		Any returnValue;
 		returnValue.typeInfo = elem.typeInfo;
-		returnValue.payload = new T(std::move(*static_cast<T*>(elem.payload)));
+		returnValue.typeId = elem.typeId;
+		returnValue.payload = construct(returnValue, std::move(*static_cast<T*>(elem.payload)));
 		returnValue.storageType = Any::storage_type::Move;
-		elem.storageType = Any::storage_type::Empty;
 		returnValue.ops = elem.ops;
+		if (elem.storageType == Any::storage_type::Copy || elem.storageType == Any::storage_type::Move) {
+			destroy(elem);
+		}
+		elem.storageType = Any::storage_type::Empty;
 		return returnValue;
 	}
 
 	static void destroy(Any& elem) {
 		assert(elem.typeInfo == GetType<T>());
-		delete static_cast<T*>(elem.payload);
+		if constexpr (is_inline_v<T>) {
+			static_cast<T*>(elem.payload)->~T();
+		} else {
+			delete static_cast<T*>(elem.payload);
+		}
 		elem.storageType = Any::storage_type::Empty;
 		elem.payload = nullptr;
 		elem.typeInfo = nullptr;
+		elem.typeId = 0;
+	}
+
+	static void relocate(Any& dst, Any& src) {
+		T* from = static_cast<T*>(src.payload);
+		dst.payload = new (dst.buffer) T(std::move(*from));
+		from->~T();
+		src.payload = nullptr;
+	}
+
+	static bool equal(const Any& lhs, const Any& rhs) {
+		return *static_cast<const T*>(lhs.payload) == *static_cast<const T*>(rhs.payload);
+	}
+
+	static size_t hash(const Any& elem) {
+		return std::hash<T>{}(*static_cast<const T*>(elem.payload));
+	}
+
+	static constexpr Any::operations make_vtable() {
+		Any::operations ops{};
+		if constexpr (std::is_copy_constructible_v<T>) {
+			ops.copy = &copy;
+		}
+		if constexpr (std::is_move_constructible_v<T>) {
+			ops.move = &move;
+		}
+		if constexpr (std::is_destructible_v<T>) {
+			ops.destroy = &destroy;
+		}
+		if constexpr (is_inline_v<T>) {
+			ops.relocate = &relocate;
+		}
+		if constexpr (detail::is_equality_comparable<T>::value) {
+			ops.equal = &equal;
+		}
+		if constexpr (detail::has_hash<T>::value) {
+			ops.hash = &hash;
+		}
+		ops.size = sizeof(T);
+		ops.alignment = alignof(T);
+		return ops;
 	}
 };
 
+// The single operation table shared by every Any holding a T
+template <typename T>
+inline constexpr Any::operations any_vtable = operations_traits<T>::make_vtable();
+
 template <typename T>
 Any make_copy(const T& elem) {
 	Any returnValue;
-	returnValue.payload = new T(elem);
+	returnValue.payload = operations_traits<T>::construct(returnValue, elem);
 	returnValue.typeInfo = GetType<T>();
+	returnValue.typeId = returnValue.typeInfo->GetId();
 	returnValue.storageType = Any::storage_type::Copy;
-	if constexpr (std::is_copy_constructible_v<T>) {
-		returnValue.ops.copy = &operations_traits<T>::copy;
-	}
-	if constexpr (std::is_move_constructible_v<T>) {
-		returnValue.ops.move = &operations_traits<T>::move;
-	}
-	if constexpr (std::is_destructible_v<T>) {
-		returnValue.ops.destroy = &operations_traits<T>::destroy;
-	}
+	returnValue.ops = &any_vtable<T>;
 	return returnValue;
 }
 
 template <typename T>
 Any make_move(T&& elem) {
 	Any returnValue;
-	returnValue.payload = new T(std::move(elem));
+	returnValue.payload = operations_traits<T>::construct(returnValue, std::move(elem));
 	returnValue.typeInfo = GetType<T>();
+	returnValue.typeId = returnValue.typeInfo->GetId();
 	returnValue.storageType = Any::storage_type::Move;
-	if constexpr (std::is_copy_constructible_v<T>) {
-		returnValue.ops.copy = &operations_traits<T>::copy;
-	}
-	if constexpr (std::is_move_constructible_v<T>) {
-		returnValue.ops.move = &operations_traits<T>::move;
-	}
-	if constexpr (std::is_destructible_v<T>) {
-		returnValue.ops.destroy = &operations_traits<T>::destroy;
-	}
+	returnValue.ops = &any_vtable<T>;
+	return returnValue;
+}
+
+// Owned Any whose T is initialized directly from factory(), e.g. a function's return value
+template <typename T, typename F>
+Any make_in_place(F&& factory) {
+	Any returnValue;
+	returnValue.payload = operations_traits<T>::construct_with(returnValue, std::forward<F>(factory));
+	returnValue.typeInfo = GetType<T>();
+	returnValue.typeId = returnValue.typeInfo->GetId();
+	returnValue.storageType = Any::storage_type::Move;
+	returnValue.ops = &any_vtable<T>;
 	return returnValue;
 }
 
@@ -128,16 +284,9 @@ Any make_ref(T& elem) {
 	Any returnValue;
 	returnValue.payload = &elem;
 	returnValue.typeInfo = GetType<T>();
+	returnValue.typeId = returnValue.typeInfo->GetId();
 	returnValue.storageType = Any::storage_type::Ref;
-	if constexpr (std::is_copy_constructible_v<T>) {
-		returnValue.ops.copy = &operations_traits<T>::copy;
-	}
-	if constexpr (std::is_move_constructible_v<T>) {
-		returnValue.ops.move = &operations_traits<T>::move;
-	}
-	if constexpr (std::is_destructible_v<T>) {
-		returnValue.ops.destroy = &operations_traits<T>::destroy;
-	}
+	returnValue.ops = &any_vtable<T>;
 	return returnValue;
 }
 
@@ -146,22 +295,15 @@ Any make_cref(const T& elem) {
 	Any returnValue;
 	returnValue.payload = const_cast<T*>(&elem);
 	returnValue.typeInfo = GetType<T>();
+	returnValue.typeId = returnValue.typeInfo->GetId();
 	returnValue.storageType = Any::storage_type::ConstRef;
-	if constexpr (std::is_copy_constructible_v<T>) {
-		returnValue.ops.copy = &operations_traits<T>::copy;
-	}
-	if constexpr (std::is_move_constructible_v<T>) {
-		returnValue.ops.move = &operations_traits<T>::move;
-	}
-	if constexpr (std::is_destructible_v<T>) {
-		returnValue.ops.destroy = &operations_traits<T>::destroy;
-	}
+	returnValue.ops = &any_vtable<T>;
 	return returnValue;
 }
 
 template <typename T>
 T* any_cast(Any& elem) {
-	if (elem.typeInfo == GetType<T>()) {
+	if (elem.typeId != 0 && elem.typeId == GetTypeId<T>()) {
 		return static_cast<T*>(elem.payload);
 	}
 	return nullptr;
@@ -169,7 +311,7 @@ T* any_cast(Any& elem) {
 
 template <typename T>
 const T* any_cast(const Any& elem) {
-	if (elem.typeInfo == GetType<T>()) {
+	if (elem.typeId != 0 && elem.typeId == GetTypeId<T>()) {
 		return static_cast<const T*>(elem.payload);
 	}
 	return nullptr;
@@ -0,0 +1,148 @@
+//
+// Created by qianq on 1/5/2026.
+//
+// Monotonic arena for request-scoped Any payloads. make_copy/make_move with an arena
+// place payloads that would otherwise go to the heap in the arena's blocks; destroying
+// such an Any only runs the destructor (nothing for trivially destructible types), and
+// the memory of all of them is released at once by reset().
+
+#pragma once
+
+#include "Any.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace my_reflect::dynamic_refl {
+
+// Bump allocator over a list of blocks. Not thread-safe: use one arena per request/thread.
+// Every Any built from the arena must be destroyed (or never used again) before reset()
+// or the arena's destruction.
+class AnyArena {
+public:
+	explicit AnyArena(size_t blockSize = 4096);
+	// Use a caller-supplied buffer first; the arena never frees it
+	AnyArena(void* buffer, size_t size, size_t blockSize = 4096);
+
+	AnyArena(const AnyArena&) = delete;
+	AnyArena& operator=(const AnyArena&) = delete;
+
+	void* allocate(size_t size, size_t alignment) {
+		auto current = reinterpret_cast<uintptr_t>(cursor_);
+		uintptr_t aligned = (current + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+		if (cursor_ != nullptr && aligned + size <= reinterpret_cast<uintptr_t>(end_)) {
+			cursor_ = reinterpret_cast<std::byte*>(aligned + size);
+			return reinterpret_cast<void*>(aligned);
+		}
+		return allocate_slow(size, alignment);
+	}
+
+	// Releases every allocation. Keeps the caller buffer and the largest block for reuse.
+	void reset() noexcept;
+
+	// Bytes handed out since the last reset, including alignment padding
+	size_t used() const;
+	// Bytes of all blocks currently held (caller buffer included)
+	size_t capacity() const;
+
+private:
+	struct Block {
+		std::byte* data;
+		size_t size;
+		std::unique_ptr<std::byte[]> owned;  // null for the caller buffer
+	};
+
+	void* allocate_slow(size_t size, size_t alignment);
+	void enter_block(size_t index);
+
+	std::vector<Block> blocks_;
+	size_t active_ = 0;              // index of the block cursor_ points into
+	size_t usedInFullBlocks_ = 0;    // bytes used in blocks before active_
+	std::byte* cursor_ = nullptr;
+	std::byte* end_ = nullptr;
+	size_t blockSize_;
+};
+
+// Vtable for Any payloads that live in an arena. Copies and moves produce ordinary
+// owned Any values (inline or heap), so they may outlive the arena.
+template <typename T>
+struct arena_operations_traits {
+	static Any copy(const Any& elem) {
+		Any returnValue = operations_traits<T>::copy(elem);
+		returnValue.ops = &any_vtable<T>;
+		return returnValue;
+	}
+
+	static Any move(Any& elem) {
+		Any returnValue;
+		returnValue.typeInfo = elem.typeInfo;
+		returnValue.typeId = elem.typeId;
+		returnValue.payload = operations_traits<T>::construct(returnValue, std::move(*static_cast<T*>(elem.payload)));
+		returnValue.storageType = Any::storage_type::Move;
+		returnValue.ops = &any_vtable<T>;
+		destroy(elem);
+		return returnValue;
+	}
+
+	static void destroy(Any& elem) {
+		if constexpr (!std::is_trivially_destructible_v<T>) {
+			static_cast<T*>(elem.payload)->~T();
+		}
+		elem.storageType = Any::storage_type::Empty;
+		elem.payload = nullptr;
+		elem.typeInfo = nullptr;
+		elem.typeId = 0;
+	}
+
+	static constexpr Any::operations make_vtable() {
+		Any::operations ops = operations_traits<T>::make_vtable();
+		if constexpr (std::is_copy_constructible_v<T>) {
+			ops.copy = &copy;
+		}
+		if constexpr (std::is_move_constructible_v<T>) {
+			ops.move = &move;
+		}
+		ops.destroy = &destroy;
+		ops.relocate = nullptr;  // arena payloads are never in the inline buffer
+		return ops;
+	}
+};
+
+template <typename T>
+inline constexpr Any::operations any_arena_vtable = arena_operations_traits<T>::make_vtable();
+
+namespace detail {
+	template <typename T, typename... Args>
+	Any make_in_arena(AnyArena& arena, Any::storage_type storage, Args&&... args) {
+		Any returnValue;
+		if constexpr (is_inline_v<T>) {
+			// Already allocation-free in the inline buffer
+			returnValue.payload = operations_traits<T>::construct(returnValue, std::forward<Args>(args)...);
+			returnValue.ops = &any_vtable<T>;
+		} else {
+			void* memory = arena.allocate(sizeof(T), alignof(T));
+			returnValue.payload = new (memory) T(std::forward<Args>(args)...);
+			returnValue.ops = &any_arena_vtable<T>;
+		}
+		returnValue.typeInfo = GetType<T>();
+		returnValue.typeId = returnValue.typeInfo->GetId();
+		returnValue.storageType = storage;
+		return returnValue;
+	}
+}
+
+template <typename T>
+Any make_copy(AnyArena& arena, const T& elem) {
+	return detail::make_in_arena<T>(arena, Any::storage_type::Copy, elem);
+}
+
+template <typename T, typename = std::enable_if_t<!std::is_lvalue_reference_v<T>>>
+Any make_move(AnyArena& arena, T&& elem) {
+	return detail::make_in_arena<T>(arena, Any::storage_type::Move, std::move(elem));
+}
+
+} // namespace my_reflect::dynamic_refl
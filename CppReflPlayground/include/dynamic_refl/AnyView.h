@@ -0,0 +1,68 @@
+//
+// Created by qianq on 1/3/2026.
+//
+// Non-owning, type-tagged views used to pass arguments to reflected calls
+// without boxing them into Any (no allocation, no copy)
+
+#pragma once
+
+#include "Any.h"
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+namespace my_reflect::dynamic_refl {
+
+// A pointer to an object plus its reflected type. Never owns the object:
+// the viewed object must outlive every use of the view.
+struct AnyView {
+	const Type* typeInfo = nullptr;
+	void* payload = nullptr;
+	TypeId typeId = 0;
+	bool isConst = false;
+
+	AnyView() = default;
+	AnyView(const Type* type, void* ptr, bool readOnly)
+		: typeInfo(type), payload(ptr), typeId(type ? type->GetId() : 0), isConst(readOnly) {}
+
+	// View the payload of an Any (ConstRef storage stays read-only)
+	AnyView(const Any& any)
+		: typeInfo(any.typeInfo), payload(any.payload), typeId(any.typeId),
+		  isConst(any.storageType == Any::storage_type::ConstRef) {}
+};
+
+// Contiguous, non-owning sequence of argument views (a minimal C++17 span)
+class ArgSpan {
+public:
+	ArgSpan() = default;
+	ArgSpan(const AnyView* data, size_t size) : data_(data), size_(size) {}
+
+	template <size_t N>
+	ArgSpan(const std::array<AnyView, N>& views) : data_(views.data()), size_(N) {}
+
+	size_t size() const { return size_; }
+	bool empty() const { return size_ == 0; }
+	const AnyView& operator[](size_t index) const { return data_[index]; }
+	const AnyView* begin() const { return data_; }
+	const AnyView* end() const { return data_ + size_; }
+
+private:
+	const AnyView* data_ = nullptr;
+	size_t size_ = 0;
+};
+
+template <typename T>
+AnyView make_view(T& elem) {
+	using RawType = std::remove_cv_t<T>;
+	return AnyView{GetType<RawType>(), const_cast<RawType*>(&elem), std::is_const_v<T>};
+}
+
+template <typename T>
+const T* view_cast(const AnyView& view) {
+	if (view.typeId != 0 && view.typeId == GetTypeId<T>()) {
+		return static_cast<const T*>(view.payload);
+	}
+	return nullptr;
+}
+
+} // namespace my_reflect::dynamic_refl
@@ -20,13 +20,16 @@ namespace my_reflect::dynamic_refl {
             Unknown, Bool, Char, Short, Int, Long, LongLong, Float, Double
         };
 
-        explicit Arithmetic(Kind kind, bool isSigned);
+        explicit Arithmetic(Kind kind, bool isSigned, size_t size = 0);
 
         template <typename T>
         static Arithmetic Create() {
-            return Arithmetic(detectKind<T>(), std::is_signed_v<T>);
+            return Arithmetic(detectKind<T>(), std::is_signed_v<T>, sizeof(T));
         }
 
+        // sizeof the C++ type, 0 if unknown
+        size_t GetSize() const { return size_; }
+
         // ========== Any Support Methods ==========
         template<typename T>
         static bool SetValue(Any& any, T value);
@@ -37,6 +40,7 @@ namespace my_reflect::dynamic_refl {
     private:
         Kind kind_;
         bool isSigned_;
+        size_t size_;
 
         static std::string getName(Kind kind);
 
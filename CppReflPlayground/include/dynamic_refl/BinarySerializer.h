@@ -0,0 +1,211 @@
+//
+// Created by qianq on 1/4/2026.
+//
+// Binary serialization driven by the runtime Class metadata, for types that are only
+// registered through Register<T>(). Produces the same bytes as static_refl::utils::to_binary
+// when both sides describe the same fields in the same order.
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "Type.h"
+#include "Thunk.h"
+#include "static_refl/binary_serializer.h"
+#include "static_refl/container_traits.h"
+
+namespace my_reflect::dynamic_refl {
+
+    // Forward declarations
+    class Any;
+    class Class;
+    template <typename T>
+    const Type* GetType();
+
+    using BinaryWriter = static_refl::utils::BinaryWriter;
+    using BinaryReader = static_refl::utils::BinaryReader;
+
+    // Encoding for a value the metadata cannot describe field by field (e.g. std::string)
+    struct BinaryCodec {
+        Thunk<void(const void* value, BinaryWriter& out)> encode = nullptr;
+        Thunk<void(void* value, BinaryReader& in)> decode = nullptr;
+
+        template <typename T>
+        static BinaryCodec Create() {
+            BinaryCodec codec;
+            codec.encode = [](const void* value, BinaryWriter& out) {
+                static_refl::utils::detail::encode_value(out, *static_cast<const T*>(value));
+            };
+            codec.decode = [](void* value, BinaryReader& in) {
+                static_refl::utils::detail::decode_value(in, *static_cast<T*>(value));
+            };
+            return codec;
+        }
+    };
+
+    // Flat list of field operations for one Class: base classes, nested classes and
+    // adjacent raw fields are folded in at compile time, so encoding is a single loop
+    class BinaryProgram {
+    public:
+        enum class OpKind : uint8_t {
+            Raw,       // memcpy size bytes at offset (arithmetic, enum, pointer runs)
+            Value,     // BinaryCodec of a leaf class
+            Container  // MemberContainer encode/decode
+        };
+
+        struct Op {
+            OpKind kind;
+            uint32_t offset;
+            uint32_t size;
+            Thunk<void(const void* value, BinaryWriter& out)> encode = nullptr;
+            Thunk<void(void* value, BinaryReader& in)> decode = nullptr;
+        };
+
+        // instance is a live object of cls, used to measure member and base offsets
+        static BinaryProgram Compile(const Class& cls, const void* instance);
+
+        void Encode(const void* instance, BinaryWriter& out) const;
+        void Decode(void* instance, BinaryReader& in) const;
+
+        const std::vector<Op>& GetOps() const { return ops_; }
+
+    private:
+        std::vector<Op> ops_;
+    };
+
+    // Program for cls, compiled on first use and cached here rather than on the Class
+    // (lock-free afterwards). It is recompiled when cls gains members or base classes, so
+    // finish registering before serializing. instance is a live object of cls; the member
+    // offsets are measured on it.
+    const BinaryProgram& GetBinaryProgram(const Class& cls, const void* instance);
+
+    // Codec for a leaf class; std::string has one by default. Register it before the first
+    // program that contains the type is compiled.
+    void RegisterBinaryCodec(const Type* type, BinaryCodec codec);
+
+    template <typename T>
+    void RegisterBinaryCodec() {
+        RegisterBinaryCodec(GetType<T>(), BinaryCodec::Create<T>());
+    }
+
+    // Encode/decode a value of the given reflected type at the given address
+    void EncodeValue(const Type* type, const void* value, BinaryWriter& out);
+    void DecodeValue(const Type* type, void* value, BinaryReader& in);
+
+    // Encode the payload of an Any (throws std::runtime_error when it is empty or not serializable)
+    void Serialize(const Any& value, BinaryWriter& out);
+    std::vector<std::byte> Serialize(const Any& value);
+
+    // Decode into the payload of an Any; const references cannot be written
+    void Deserialize(Any& value, BinaryReader& in);
+    void Deserialize(Any& value, const std::vector<std::byte>& data);
+
+    namespace binary_detail {
+        template <typename T>
+        constexpr bool is_raw_element_v = std::is_arithmetic_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>;
+
+        // Smallest encoding of one element, used to reject impossible counts
+        template <typename T>
+        constexpr size_t MinElementSize() {
+            if constexpr (is_raw_element_v<T>) {
+                return sizeof(T);
+            } else if constexpr (static_refl::utils::detail::is_container_kind<T>(static_refl::ContainerKind::Array)) {
+                return std::tuple_size_v<T> * MinElementSize<typename T::value_type>();  // no count prefix
+            } else if constexpr (std::is_same_v<T, std::string> || static_refl::is_container_v<T>) {
+                return sizeof(static_refl::utils::binary_size_t);
+            } else {
+                return 0;
+            }
+        }
+
+        template <typename T>
+        void EncodeElement(const T& value, BinaryWriter& out) {
+            if constexpr (is_raw_element_v<T>) {
+                out.write(&value, sizeof(T));
+            } else {
+                EncodeValue(GetType<T>(), &value, out);
+            }
+        }
+
+        template <typename T>
+        T DecodeElement(BinaryReader& in) {
+            if constexpr (!std::is_default_constructible_v<T>) {
+                throw std::runtime_error("Container element type is not default constructible");
+            } else {
+                T value{};
+                if constexpr (is_raw_element_v<T>) {
+                    in.read(&value, sizeof(T));
+                } else {
+                    DecodeValue(GetType<T>(), &value, in);
+                }
+                return value;
+            }
+        }
+
+        template <typename T>
+        void EncodeContainer(const T& container, BinaryWriter& out) {
+            using V_Type = static_refl::container_traits_value_t<T>;
+            constexpr static_refl::ContainerKind kind = static_refl::container_kind_v<T>;
+
+            if constexpr (kind == static_refl::ContainerKind::Array) {
+                // Fixed size: no count, like static_refl (raw bytes when trivially copyable)
+                for (const auto& elem : container) {
+                    EncodeElement(elem, out);
+                }
+                return;
+            }
+
+            out.write_size(container.size());
+            if constexpr (static_refl::is_map_kind(kind)) {
+                for (const auto& [key, value] : container) {
+                    EncodeElement(key, out);
+                    EncodeElement(value, out);
+                }
+            } else if constexpr (kind == static_refl::ContainerKind::Vector
+                                 && is_raw_element_v<V_Type> && !std::is_same_v<V_Type, bool>) {
+                out.write(container.data(), container.size() * sizeof(V_Type));
+            } else {
+                for (const auto& elem : container) {
+                    EncodeElement(static_cast<const V_Type&>(elem), out);
+                }
+            }
+        }
+
+        template <typename T>
+        void DecodeContainer(T& container, BinaryReader& in) {
+            using V_Type = static_refl::container_traits_value_t<T>;
+            constexpr static_refl::ContainerKind kind = static_refl::container_kind_v<T>;
+
+            if constexpr (kind == static_refl::ContainerKind::Array) {
+                for (auto& elem : container) {
+                    elem = DecodeElement<V_Type>(in);
+                }
+            } else if constexpr (static_refl::is_map_kind(kind)) {
+                using K_Type = static_refl::container_traits_key_t<T>;
+                size_t count = in.read_size(MinElementSize<K_Type>() + MinElementSize<V_Type>());
+                container.clear();
+                for (size_t i = 0; i < count; ++i) {
+                    K_Type key = DecodeElement<K_Type>(in);
+                    V_Type value = DecodeElement<V_Type>(in);
+                    container.emplace_hint(container.end(), std::move(key), std::move(value));
+                }
+            } else if constexpr (kind == static_refl::ContainerKind::Vector
+                                 && is_raw_element_v<V_Type> && !std::is_same_v<V_Type, bool>) {
+                size_t count = in.read_size(sizeof(V_Type));
+                container.resize(count);
+                in.read(container.data(), count * sizeof(V_Type));
+            } else {
+                size_t count = in.read_size(MinElementSize<V_Type>());
+                container.clear();
+                for (size_t i = 0; i < count; ++i) {
+                    container.insert(container.end(), DecodeElement<V_Type>(in));
+                }
+            }
+        }
+    }
+
+}
@@ -5,12 +5,15 @@
 #pragma once
 #include "Type.h"
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "TypeRegistry.h"
 #include "MemberFunction.h"
 #include "MemberVariable.h"
 #include "MemberContainer.h"
+#include "NameIndex.h"
+#include "dynamic_refl_util.h"
 #include "static_refl/container_traits.h"
 
 namespace my_reflect::dynamic_refl {
@@ -23,22 +26,46 @@ namespace my_reflect::dynamic_refl {
         Class();
         explicit Class(const std::string& name);
 
-        std::vector<const Class*> baseClasses_;
-        std::vector<MemberFunction> memberFunctions_;
-        std::vector<MemberVariable> memberVariables_;
-        std::vector<MemberContainer> memberContainers_;
+        // Members are only added through AddVar/AddFunc/AddContainer/AddBaseClass, which keep
+        // the name index and the base offsets in step with these lists
+        const std::vector<const Class*>& GetBaseClasses() const { return baseClasses_; }
+        const std::vector<MemberFunction>& GetMemberFunctions() const { return memberFunctions_; }
+        const std::vector<MemberVariable>& GetMemberVariables() const { return memberVariables_; }
+        const std::vector<MemberContainer>& GetMemberContainers() const { return memberContainers_; }
 
         void AddVar(MemberVariable&& variable);
         void AddFunc(MemberFunction&& function);
         void AddContainer(MemberContainer&& container);
+        // offset: measures the base subobject inside a live instance of this class (null = 0)
+        void AddBaseClass(const Class* base, Thunk<size_t(const void* instance)> offset = nullptr);
+        size_t GetBaseOffset(size_t index, const void* instance) const;
 
         // ========== Any Support Methods ==========
-        Any GetMemberValue(Any& instance, const std::string& memberName) const;
-        bool SetMemberValue(Any& instance, const std::string& memberName, const Any& value) const;
+        Any GetMemberValue(Any& instance, std::string_view memberName) const;
+        bool SetMemberValue(Any& instance, std::string_view memberName, const Any& value) const;
 
+        // ========== Name Lookup (hashed, allocation-free) ==========
         // Find member function by name (for invoke support)
-        const MemberFunction* FindFunction(const std::string& name) const;
+        const MemberFunction* FindFunction(std::string_view name) const;
+        const MemberVariable* FindVariable(std::string_view name) const;
+        const MemberContainer* FindContainer(std::string_view name) const;
+
+    private:
+        std::vector<const Class*> baseClasses_;
+        std::vector<MemberFunction> memberFunctions_;
+        std::vector<MemberVariable> memberVariables_;
+        std::vector<MemberContainer> memberContainers_;
+
+        // Parallel to baseClasses_; a null thunk means offset 0
+        std::vector<Thunk<size_t(const void* instance)>> baseOffsets_;
 
+        // Name -> position in memberFunctions_/memberVariables_/memberContainers_,
+        // kept up to date by AddFunc/AddVar/AddContainer
+        NameIndex nameIndex_;
+
+        template <typename Member>
+        static const Member* FindIn(const std::vector<Member>& members, const NameIndex& index,
+                                    NameIndex::Kind kind, std::string_view name);
     };
 
     template <typename T>
@@ -62,9 +89,9 @@ namespace my_reflect::dynamic_refl {
                 // Extract member type from member pointer
                 using MemberType = std::remove_cv_t<std::remove_reference_t<decltype(std::declval<T>().*std::declval<U>())>>;
                 if constexpr (static_refl::is_container_v<MemberType>) {
-                    info_.AddContainer(MemberContainer::Create<MemberType>(name));
+                    info_.AddContainer(MemberContainer::Create(name, ptr));
                 } else {
-                    info_.AddVar(MemberVariable::Create<U>(name));
+                    info_.AddVar(MemberVariable::Create<U>(name, ptr));
                 }
             }
             return *this;
@@ -89,7 +116,11 @@ namespace my_reflect::dynamic_refl {
         template <typename U>
         ClassFactory& AddBaseClass() {
             static_assert(std::is_class_v<U>, "Base class must be a class type");
-            info_.baseClasses_.push_back(static_cast<const Class*>(GetType<U>()));
+            static_assert(std::is_base_of_v<U, T>, "U must be a base class of T");
+            static_assert(utils::is_fixed_base_v<T, U>,
+                          "U must be an unambiguous, non-virtual base of T (virtual bases have no fixed offset)");
+            info_.AddBaseClass(static_cast<const Class*>(GetType<U>()),
+                               [](const void* instance) { return utils::BaseOffset<T, U>(instance); });
             return *this;
         }
 
@@ -5,7 +5,13 @@
 #pragma once
 #include "Type.h"
 #include "TypeRegistry.h"
+#include "NameIndex.h"
+#include <atomic>
+#include <cstdint>
+#include <mutex>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 #include <optional>
 
@@ -27,21 +33,53 @@ namespace my_reflect::dynamic_refl {
 
         template <typename T>
         void add(const std::string& name, T value) {
-            items_.emplace_back(Item{name, static_cast<Item::value_type>(value)});
+            AddItem(name, static_cast<Item::value_type>(value));
         }
 
         const auto& GetItems() const { return items_; }
         size_t GetUnderlyingSize() const { return underlyingSize_; }
 
         // ========== Any Support Methods ==========
-        bool SetByName(Any& any, const std::string& name) const;
+        bool SetByName(Any& any, std::string_view name) const;
         bool SetByValue(Any& any, long long value) const;
         std::optional<std::string> GetName(const Any& any) const;
         std::optional<long long> GetValue(const Any& any) const;
 
+        // Name of the enumerator held by any, or an empty view if the value has none.
+        // The view points into this Enum (valid until the next add); nothing is copied.
+        std::string_view GetNameView(const Any& any) const;
+
+        // ========== Lookup Tables ==========
+        // The name index is kept up to date by add(); the value tables are built on the first
+        // value lookup after an add. The first item registered for a value/name wins.
+        // Value to name: O(1) through a dense table when the values are (nearly) contiguous,
+        // binary search over the sorted values otherwise. Empty view if not found.
+        std::string_view FindName(long long value) const;
+        // Name to value: hashed lookup, no allocation
+        std::optional<long long> FindValue(std::string_view name) const;
+        // Whether value lookups currently use the dense table
+        bool IsDense() const;
+
     private:
+        void AddItem(const std::string& name, long long value);
+        // Called by FindItem when valueIndexReady_ is false; safe to race with other lookups
+        void RebuildValueIndex() const;
+        void BuildValueTables() const;
+        // The one value lookup: builds the value tables first if an add invalidated them
+        const Item* FindItem(long long value) const;
+
         std::vector<Item> items_;
         size_t underlyingSize_; // Size of the underlying enum type
+
+        NameIndex nameIndex_;
+        // Value tables, rebuilt under valueIndexMutex_ when valueIndexReady_ is false
+        mutable std::atomic<bool> valueIndexReady_{true};
+        mutable std::mutex valueIndexMutex_;
+        // Dense: denseItems_[value - denseMin_] is an item index, or -1 for a gap
+        mutable long long denseMin_ = 0;
+        mutable std::vector<int32_t> denseItems_;
+        // Sparse fallback: (value, item index) sorted by value, used when denseItems_ is empty
+        mutable std::vector<std::pair<long long, uint32_t>> sortedValues_;
     };
 
     template <typename T>
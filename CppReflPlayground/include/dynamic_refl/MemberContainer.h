@@ -3,10 +3,18 @@
 //
 
 #pragma once
+#include <cstddef>
+#include <functional>
+#include <new>
 #include <string>
+#include <type_traits>
 #include <utility>
-#include <functional>
+#include <vector>
 #include "Type.h"
+#include "Thunk.h"
+#include "AnyView.h"
+#include "MemberVariable.h"
+#include "BinarySerializer.h"
 #include "static_refl/container_traits.h"
 #include "static_refl/field_traits.h"
 
@@ -16,15 +24,100 @@ namespace my_reflect::dynamic_refl {
     const Type* GetType();
     class Any;
 
-    // Type-erased container operations
+    // One element seen through a cursor or ForEach. Non-owning views, valid as long as the element.
+    // key is empty except for maps. Set elements and map keys are read-only; vector elements and
+    // map values are read-only when the container Any is a ConstRef.
+    struct ContainerElement {
+        AnyView key;
+        AnyView value;
+    };
+
+    // Position inside a container, set up by ContainerOperations::begin and advanced by next.
+    // Anything that invalidates the container's iterators invalidates the cursor.
+    struct ContainerCursor {
+        static constexpr size_t state_size = 4 * sizeof(void*);
+
+        ContainerElement element;  // the current element while valid
+        bool valid = false;        // false once past the last element
+        // Contiguous containers (vector, array): element size in bytes and one-past-the-end address,
+        // so stepping needs no indirect call (see StepContiguous). 0 for node-based containers.
+        size_t stride = 0;
+        const void* end = nullptr;
+        alignas(void*) unsigned char state[state_size] = {};  // the container's iterators
+
+        bool StepContiguous() {
+            auto* next = static_cast<unsigned char*>(element.value.payload) + stride;
+            valid = valid && next != end;
+            element.value.payload = next;
+            return valid;
+        }
+    };
+
+    namespace container_detail {
+        // Calls an element callback returning void or bool; false means stop
+        template <typename F>
+        bool CallOnElement(F& callable, const ContainerElement& element) {
+            if constexpr (std::is_void_v<std::invoke_result_t<F&, const ContainerElement&>>) {
+                callable(element);
+                return true;
+            } else {
+                return static_cast<bool>(callable(element));
+            }
+        }
+    }
+
+    // Non-owning reference to a callable taking const ContainerElement&, returning void or
+    // bool (false stops the iteration). The callable must outlive the call it is passed to.
+    class ElementCallback {
+    public:
+        template <typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, ElementCallback>>>
+        ElementCallback(F& callable)
+            : callable_(const_cast<void*>(static_cast<const void*>(&callable))),
+              call_([](void* target, const ContainerElement& element) -> bool {
+                  return container_detail::CallOnElement(*static_cast<F*>(target), element);
+              }) {}
+
+        bool operator()(const ContainerElement& element) const { return call_(callable_, element); }
+
+    private:
+        void* callable_;
+        bool (*call_)(void*, const ContainerElement&);
+    };
+
+    // The element block of a std::vector or std::array with trivially copyable elements: element i
+    // lives at data + i * stride. Valid until the vector reallocates. isConst when seen through a ConstRef.
+    struct ContiguousBlock {
+        void* data = nullptr;
+        const Type* elementType = nullptr;
+        size_t stride = 0;
+        size_t count = 0;
+        bool isConst = false;
+    };
+
+    // Type-erased container operations, stored as function-pointer thunks
     struct ContainerOperations {
-        std::function<size_t(const Any&)> size = nullptr;
-        std::function<void(Any&)> clear = nullptr;
-        std::function<bool(Any&, const Any&)> push = nullptr;  // for vector/set
-        std::function<Any(const Any&, size_t)> at = nullptr;   // for vector
-        std::function<bool(Any&, const Any&, const Any&)> insert_kv = nullptr;  // for map
-        std::function<Any(const Any&, const Any&)> get_value = nullptr;  // for map
-        std::function<bool(const Any&, const Any&)> contains_key = nullptr;  // for map
+        Thunk<size_t(const Any&)> size = nullptr;
+        Thunk<void(Any&)> clear = nullptr;
+        Thunk<bool(Any&, const Any&)> push = nullptr;  // for vector/deque/set
+        Thunk<Any(const Any&, size_t)> at = nullptr;   // for vector/deque/array
+        Thunk<bool(Any&, const Any&, const Any&)> insert_kv = nullptr;  // for map
+        Thunk<Any(const Any&, const Any&)> get_value = nullptr;  // for map
+        Thunk<bool(const Any&, const Any&)> contains_key = nullptr;  // for map/set
+        // Move variants: an Any owning its payload (Copy/Move storage) is moved from and reset
+        Thunk<bool(Any&, Any&)> push_move = nullptr;  // for vector/deque/set
+        Thunk<bool(Any&, Any&, Any&)> emplace_kv = nullptr;  // for map: insert or assign
+        Thunk<bool(Any&, Any&, Any&)> try_emplace = nullptr;  // for map: false if the key exists
+        Thunk<ContiguousBlock(const Any&)> contiguous = nullptr;  // vector/array of trivially copyable
+        Thunk<void(Any&, size_t)> reserve = nullptr;  // for vector
+        Thunk<void(Any&, size_t)> resize = nullptr;   // for vector/deque
+        // Replace / extend a vector or deque with count elements at data; false if elementType does not match
+        Thunk<bool(Any&, const void* data, size_t count, const Type* elementType)> assign_range = nullptr;
+        Thunk<bool(Any&, const void* data, size_t count, const Type* elementType)> append_range = nullptr;
+        Thunk<bool(const Any&, ContainerCursor&)> begin = nullptr;  // false if the container is empty
+        Thunk<bool(ContainerCursor&)> next = nullptr;               // false once past the end
+        Thunk<size_t(const Any&, ElementCallback)> for_each = nullptr;  // returns elements visited
+        Thunk<void(const void* container, BinaryWriter& out)> encode = nullptr;
+        Thunk<void(void* container, BinaryReader& in)> decode = nullptr;
     };
 
     class MemberContainer {
@@ -34,6 +127,8 @@ namespace my_reflect::dynamic_refl {
         const Type* keyType_;
         static_refl::ContainerKind kind_;
         ContainerOperations ops_;
+        // Access to the whole container inside its owner; empty unless created from a member pointer
+        MemberAccessor accessor_;
 
         MemberContainer(std::string name, static_refl::ContainerKind kind, const Type* valueType,
                        const Type* keyType = nullptr, ContainerOperations ops = {});
@@ -41,6 +136,13 @@ namespace my_reflect::dynamic_refl {
 
         template <typename T>
         static MemberContainer Create(std::string name);
+
+        template <typename T, typename ClassT>
+        static MemberContainer Create(std::string name, T ClassT::* ptr) {
+            MemberContainer container = Create<T>(std::move(name));
+            container.accessor_ = MemberAccessor::Create(ptr);
+            return container;
+        }
     };
 
 }
@@ -50,6 +152,290 @@ namespace my_reflect::dynamic_refl {
 
 namespace my_reflect::dynamic_refl {
 
+    namespace container_detail {
+        // vector<bool> elements are proxies without an address, so they cannot be viewed
+        template <typename T>
+        constexpr bool has_addressable_elements_v =
+            std::is_lvalue_reference_v<decltype(*std::declval<typename T::const_iterator>())>;
+
+        // Node-based containers keep their iterators in the cursor
+        template <typename T>
+        struct IteratorState {
+            typename T::const_iterator current;
+            typename T::const_iterator end;
+        };
+
+        // deque iterators are four pointers each; an index is smaller and trivially copyable
+        template <typename T>
+        struct IndexState {
+            const T* container;
+            size_t index;
+        };
+
+        template <typename T>
+        using CursorState = std::conditional_t<static_refl::container_kind_v<T> == static_refl::ContainerKind::Deque,
+                                               IndexState<T>, IteratorState<T>>;
+
+        // Element views with the types filled in once; only the payloads change per element
+        template <typename T, static_refl::ContainerKind kind>
+        ContainerElement ElementShape(bool constContainer) {
+            using V_Type = static_refl::container_traits_value_t<T>;
+            ContainerElement element;
+            if constexpr (static_refl::is_map_kind(kind)) {
+                using K_Type = static_refl::container_traits_key_t<T>;
+                element.key = AnyView{GetType<K_Type>(), nullptr, true};
+                element.value = AnyView{GetType<V_Type>(), nullptr, constContainer};
+            } else {
+                element.value = AnyView{GetType<V_Type>(), nullptr, constContainer || static_refl::is_set_kind(kind)};
+            }
+            return element;
+        }
+
+        template <static_refl::ContainerKind kind, typename Iterator>
+        void PointAt(ContainerElement& element, Iterator it) {
+            if constexpr (static_refl::is_map_kind(kind)) {
+                element.key.payload = const_cast<void*>(static_cast<const void*>(&it->first));
+                element.value.payload = const_cast<void*>(static_cast<const void*>(&it->second));
+            } else {
+                element.value.payload = const_cast<void*>(static_cast<const void*>(&*it));
+            }
+        }
+
+        template <typename T>
+        void AddIteration(ContainerOperations& ops) {
+            constexpr static_refl::ContainerKind kind = static_refl::container_kind_v<T>;
+            using State = CursorState<T>;
+            static_assert(sizeof(State) <= ContainerCursor::state_size && alignof(State) <= alignof(void*),
+                          "container iterators must fit the cursor state");
+            static_assert(std::is_trivially_copyable_v<State> && std::is_trivially_destructible_v<State>,
+                          "container iterators must be trivially copyable");
+
+            ops.begin = [](const Any& any, ContainerCursor& cursor) -> bool {
+                auto* container = any_cast<T>(any);
+                if (!container) {
+                    throw std::runtime_error("any_cast failed in container begin()");
+                }
+                cursor.element = ElementShape<T, kind>(any.storage() == Any::storage_type::ConstRef);
+                cursor.valid = !container->empty();
+                // A reused cursor may still carry a previous vector's stride
+                cursor.stride = 0;
+                cursor.end = nullptr;
+                if constexpr (static_refl::is_contiguous_kind(kind)) {
+                    cursor.stride = sizeof(static_refl::container_traits_value_t<T>);
+                    cursor.end = container->data() + container->size();
+                    cursor.element.value.payload = const_cast<void*>(static_cast<const void*>(container->data()));
+                } else if constexpr (kind == static_refl::ContainerKind::Deque) {
+                    new (cursor.state) State{container, 0};
+                    if (cursor.valid) {
+                        PointAt<kind>(cursor.element, container->begin());
+                    }
+                } else {
+                    auto* state = new (cursor.state) State{container->begin(), container->end()};
+                    if (cursor.valid) {
+                        PointAt<kind>(cursor.element, state->current);
+                    }
+                }
+                return cursor.valid;
+            };
+
+            ops.next = [](ContainerCursor& cursor) -> bool {
+                if constexpr (static_refl::is_contiguous_kind(kind)) {
+                    return cursor.StepContiguous();
+                } else if constexpr (kind == static_refl::ContainerKind::Deque) {
+                    auto* state = std::launder(reinterpret_cast<State*>(cursor.state));
+                    if (cursor.valid && ++state->index < state->container->size()) {
+                        cursor.element.value.payload = const_cast<void*>(
+                            static_cast<const void*>(&(*state->container)[state->index]));
+                        return true;
+                    }
+                    cursor.valid = false;
+                    return false;
+                } else {
+                    auto* state = std::launder(reinterpret_cast<State*>(cursor.state));
+                    if (cursor.valid && ++state->current != state->end) {
+                        PointAt<kind>(cursor.element, state->current);
+                        return true;
+                    }
+                    cursor.valid = false;
+                    return false;
+                }
+            };
+
+            ops.for_each = [](const Any& any, ElementCallback callback) -> size_t {
+                auto* container = any_cast<T>(any);
+                if (!container) {
+                    throw std::runtime_error("any_cast failed in container for_each()");
+                }
+                ContainerElement element = ElementShape<T, kind>(any.storage() == Any::storage_type::ConstRef);
+                size_t visited = 0;
+                for (auto it = container->begin(); it != container->end(); ++it) {
+                    PointAt<kind>(element, it);
+                    ++visited;
+                    if (!callback(element)) {
+                        break;
+                    }
+                }
+                return visited;
+            };
+        }
+
+        // Calls use with the payload of value as V&& when value owns it (Copy/Move storage) and
+        // as const V& otherwise (Ref/ConstRef are never moved from). False if value is not a V
+        // or a view of a non-copyable V.
+        template <typename V, typename Use>
+        bool WithValue(Any& value, Use&& use) {
+            V* payload = any_cast<V>(value);
+            if (!payload) {
+                return false;
+            }
+            if (value.storage() == Any::storage_type::Copy || value.storage() == Any::storage_type::Move) {
+                return use(std::move(*payload));
+            }
+            if constexpr (std::is_copy_constructible_v<V>) {
+                return use(static_cast<const V&>(*payload));
+            } else {
+                return false;
+            }
+        }
+
+        // Leaves an Any whose payload was moved out empty; views are left alone
+        inline void ReleaseIfOwned(Any& value) {
+            if (value.storage() == Any::storage_type::Copy || value.storage() == Any::storage_type::Move) {
+                value = Any{};
+            }
+        }
+
+        // True if [first, first + count) overlaps the elements of seq. assign() would overwrite
+        // such a range before reading it, and a vector insert() may reallocate it away first.
+        // O(1) for vectors; deques have no single block, so their elements are checked one by one.
+        template <typename T, typename V>
+        bool RangeAliases(const T& seq, const V* first, size_t count) {
+            std::less<const V*> before;
+            const V* last = first + count;
+            if (count == 0 || seq.empty()) {
+                return false;
+            }
+            if constexpr (static_refl::container_kind_v<T> == static_refl::ContainerKind::Vector) {
+                return before(first, seq.data() + seq.size()) && before(seq.data(), last);
+            } else {
+                for (const V& element : seq) {
+                    if (!before(&element, first) && before(&element, last)) {
+                        return true;
+                    }
+                }
+                return false;
+            }
+        }
+
+        // Operations for sequences: vector, deque (push, at, resize, ranges) and array (at)
+        template <typename T>
+        void AddSequenceOperations(ContainerOperations& ops) {
+            using V_Type = static_refl::container_traits_value_t<T>;
+            constexpr static_refl::ContainerKind kind = static_refl::container_kind_v<T>;
+            constexpr bool growable = kind != static_refl::ContainerKind::Array;
+
+            ops.at = [](const Any& any, size_t index) -> Any {
+                auto* seq = any_cast<T>(any);
+                if (seq && index < seq->size()) {
+                    return make_cref((*seq)[index]);
+                }
+                throw std::out_of_range("Container index out of range");
+            };
+
+            if constexpr (growable) {
+                ops.push = [](Any& any, const Any& value) -> bool {
+                    auto* seq = any_cast<T>(any);
+                    auto* val = any_cast<V_Type>(value);
+                    if (seq && val) {
+                        seq->push_back(*val);
+                        return true;
+                    }
+                    return false;
+                };
+
+                ops.push_move = [](Any& any, Any& value) -> bool {
+                    auto* seq = any_cast<T>(any);
+                    bool pushed = seq && WithValue<V_Type>(value, [seq](auto&& val) {
+                        seq->push_back(std::forward<decltype(val)>(val));
+                        return true;
+                    });
+                    if (pushed) {
+                        ReleaseIfOwned(value);
+                    }
+                    return pushed;
+                };
+            }
+
+            if constexpr (kind == static_refl::ContainerKind::Vector) {
+                ops.reserve = [](Any& any, size_t capacity) {
+                    if (auto* vec = any_cast<T>(any)) {
+                        vec->reserve(capacity);
+                        return;
+                    }
+                    throw std::runtime_error("any_cast failed in container reserve()");
+                };
+            }
+
+            if constexpr (growable && std::is_default_constructible_v<V_Type>) {
+                ops.resize = [](Any& any, size_t size) {
+                    if (auto* seq = any_cast<T>(any)) {
+                        seq->resize(size);
+                        return;
+                    }
+                    throw std::runtime_error("any_cast failed in container resize()");
+                };
+            }
+
+            if constexpr (growable && has_addressable_elements_v<T> && std::is_copy_constructible_v<V_Type>) {
+                // One range copy; memmove for trivially copyable vector elements
+                ops.assign_range = [](Any& any, const void* data, size_t count, const Type* elementType) -> bool {
+                    auto* seq = any_cast<T>(any);
+                    if (!seq || elementType != GetType<V_Type>()) {
+                        return false;
+                    }
+                    auto* first = static_cast<const V_Type*>(data);
+                    if (RangeAliases(*seq, first, count)) {
+                        std::vector<V_Type> copy(first, first + count);
+                        seq->assign(copy.begin(), copy.end());
+                    } else {
+                        seq->assign(first, first + count);
+                    }
+                    return true;
+                };
+
+                ops.append_range = [](Any& any, const void* data, size_t count, const Type* elementType) -> bool {
+                    auto* seq = any_cast<T>(any);
+                    if (!seq || elementType != GetType<V_Type>()) {
+                        return false;
+                    }
+                    auto* first = static_cast<const V_Type*>(data);
+                    // Appending to a deque never moves its elements, so only vectors need the copy
+                    if constexpr (kind == static_refl::ContainerKind::Vector) {
+                        if (RangeAliases(*seq, first, count)) {
+                            std::vector<V_Type> copy(first, first + count);
+                            seq->insert(seq->end(), copy.begin(), copy.end());
+                            return true;
+                        }
+                    }
+                    seq->insert(seq->end(), first, first + count);
+                    return true;
+                };
+            }
+
+            if constexpr (static_refl::is_contiguous_kind(kind) && has_addressable_elements_v<T>
+                          && std::is_trivially_copyable_v<V_Type>) {
+                ops.contiguous = [](const Any& any) -> ContiguousBlock {
+                    auto* seq = any_cast<T>(any);
+                    if (!seq) {
+                        throw std::runtime_error("any_cast failed in container contiguous()");
+                    }
+                    return ContiguousBlock{const_cast<V_Type*>(seq->data()), GetType<V_Type>(), sizeof(V_Type),
+                                           seq->size(), any.storage() == Any::storage_type::ConstRef};
+                };
+            }
+        }
+    }
+
     template <typename T>
     MemberContainer MemberContainer::Create(std::string name) {
         using V_Type = static_refl::container_traits_value_t<T>;
@@ -65,53 +451,77 @@ namespace my_reflect::dynamic_refl {
             throw std::runtime_error("any_cast failed in container size()");
         };
 
-        // Clear operation (common for all containers)
-        ops.clear = [](Any& any) {
-            if (auto* ptr = any_cast<T>(any)) {
-                ptr->clear();
-                return;
-            }
-            throw std::runtime_error("any_cast failed in container clear()");
+        // Clear operation (all containers except the fixed-size std::array)
+        if constexpr (kind != static_refl::ContainerKind::Array) {
+            ops.clear = [](Any& any) {
+                if (auto* ptr = any_cast<T>(any)) {
+                    ptr->clear();
+                    return;
+                }
+                throw std::runtime_error("any_cast failed in container clear()");
+            };
+        }
+
+        // Binary encoding (common for all containers)
+        ops.encode = [](const void* container, BinaryWriter& out) {
+            binary_detail::EncodeContainer(*static_cast<const T*>(container), out);
+        };
+
+        ops.decode = [](void* container, BinaryReader& in) {
+            binary_detail::DecodeContainer(*static_cast<T*>(container), in);
         };
 
-        if constexpr (kind == static_refl::ContainerKind::Vector) {
-            // Vector-specific operations
+        // Cursor and ForEach (common for all containers with addressable elements)
+        if constexpr (container_detail::has_addressable_elements_v<T>) {
+            container_detail::AddIteration<T>(ops);
+        }
+
+        if constexpr (kind == static_refl::ContainerKind::Vector || kind == static_refl::ContainerKind::Deque
+                      || kind == static_refl::ContainerKind::Array) {
+            container_detail::AddSequenceOperations<T>(ops);
+            return MemberContainer{std::move(name), kind, GetType<V_Type>(), nullptr, std::move(ops)};
+        }
+        else if constexpr (static_refl::is_set_kind(kind)) {
+            // Set-specific operations (hashed lookup for unordered_set)
             ops.push = [](Any& any, const Any& value) -> bool {
-                auto* vec = any_cast<T>(any);
+                auto* set = any_cast<T>(any);
                 auto* val = any_cast<V_Type>(value);
-                if (vec && val) {
-                    vec->push_back(*val);
+                if (set && val) {
+                    set->insert(*val);
                     return true;
                 }
                 return false;
             };
 
-            ops.at = [](const Any& any, size_t index) -> Any {
-                auto* vec = any_cast<T>(any);
-                if (vec && index < vec->size()) {
-                    return make_cref((*vec)[index]);
+            ops.push_move = [](Any& any, Any& value) -> bool {
+                auto* set = any_cast<T>(any);
+                bool inserted = false;
+                // With an equal element already present, value is neither moved from nor released
+                bool accepted = set && container_detail::WithValue<V_Type>(value, [set, &inserted](auto&& val) {
+                    if (set->find(val) == set->end()) {
+                        inserted = set->insert(std::forward<decltype(val)>(val)).second;
+                    }
+                    return true;
+                });
+                if (inserted) {
+                    container_detail::ReleaseIfOwned(value);
                 }
-                throw std::out_of_range("Container index out of range");
+                return accepted;
             };
 
-            return MemberContainer{std::move(name), kind, GetType<V_Type>(), nullptr, std::move(ops)};
-        }
-        else if constexpr (kind == static_refl::ContainerKind::Set) {
-            // Set-specific operations
-            ops.push = [](Any& any, const Any& value) -> bool {
+            ops.contains_key = [](const Any& any, const Any& value) -> bool {
                 auto* set = any_cast<T>(any);
                 auto* val = any_cast<V_Type>(value);
                 if (set && val) {
-                    set->insert(*val);
-                    return true;
+                    return set->find(*val) != set->end();
                 }
                 return false;
             };
 
             return MemberContainer{std::move(name), kind, GetType<V_Type>(), nullptr, std::move(ops)};
         }
-        else if constexpr (kind == static_refl::ContainerKind::Map) {
-            // Map-specific operations
+        else if constexpr (static_refl::is_map_kind(kind)) {
+            // Map-specific operations (hashed lookup for unordered_map)
             using K_Type = static_refl::container_traits_key_t<T>;
 
             ops.insert_kv = [](Any& any, const Any& key, const Any& value) -> bool {
@@ -119,12 +529,45 @@ namespace my_reflect::dynamic_refl {
                 auto* k = any_cast<K_Type>(key);
                 auto* v = any_cast<V_Type>(value);
                 if (map && k && v) {
-                    (*map)[*k] = *v;
+                    map->insert_or_assign(*k, *v);
                     return true;
                 }
                 return false;
             };
 
+            ops.emplace_kv = [](Any& any, Any& key, Any& value) -> bool {
+                auto* map = any_cast<T>(any);
+                // Both types are checked before anything is moved
+                bool stored = map && any_cast<V_Type>(value) &&
+                    container_detail::WithValue<K_Type>(key, [&](auto&& k) {
+                        return container_detail::WithValue<V_Type>(value, [&](auto&& v) {
+                            map->insert_or_assign(std::forward<decltype(k)>(k), std::forward<decltype(v)>(v));
+                            return true;
+                        });
+                    });
+                if (stored) {
+                    container_detail::ReleaseIfOwned(key);
+                    container_detail::ReleaseIfOwned(value);
+                }
+                return stored;
+            };
+
+            ops.try_emplace = [](Any& any, Any& key, Any& value) -> bool {
+                auto* map = any_cast<T>(any);
+                // try_emplace does not touch key or value when the key is already present
+                bool inserted = map && any_cast<V_Type>(value) &&
+                    container_detail::WithValue<K_Type>(key, [&](auto&& k) {
+                        return container_detail::WithValue<V_Type>(value, [&](auto&& v) {
+                            return map->try_emplace(std::forward<decltype(k)>(k), std::forward<decltype(v)>(v)).second;
+                        });
+                    });
+                if (inserted) {
+                    container_detail::ReleaseIfOwned(key);
+                    container_detail::ReleaseIfOwned(value);
+                }
+                return inserted;
+            };
+
             ops.get_value = [](const Any& any, const Any& key) -> Any {
                 auto* map = any_cast<T>(any);
                 auto* k = any_cast<K_Type>(key);
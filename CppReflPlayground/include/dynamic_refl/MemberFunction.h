@@ -3,11 +3,15 @@
 //
 
 #pragma once
+#include <array>
+#include <cassert>
 #include <string>
 #include <vector>
-#include <functional>
 
 #include "Type.h"
+#include "Any.h"
+#include "AnyView.h"
+#include "Thunk.h"
 #include "../static_refl/function_traits.h"
 #include "../static_refl/type_list.h"
 
@@ -17,23 +21,54 @@ namespace my_reflect::dynamic_refl {
     template <typename T>
     const Type* GetType();
     class Any;
+    class ThreadPool;
+
+    // How MemberFunction::InvokeBatch runs its loop
+    struct BatchOptions {
+        ThreadPool* pool = nullptr;  // null: run on the calling thread
+        size_t minChunk = 1024;      // smallest slice of instances handed to one pool thread
+    };
 
     class MemberFunction {
     public:
+        // Invoker without type checks: instance and argument payloads are cast directly
+        using UncheckedInvoker = Thunk<Any(void* instance, const AnyView* args)>;
+
         std::string name_;
         const Type* retType_;
         std::vector<const Type*> argTypes_;
+        const Type* classType_ = nullptr;
+        // A const member function; only const ones may be called on a ConstRef instance
+        bool isConst_ = false;
 
-        // Type-erased function invoker: takes instance and args, returns result
-        std::function<Any(Any&, const std::vector<Any>&)> invoker_;
+        // Type-erased function invoker: takes instance and non-owning argument views, returns result
+        Thunk<Any(Any&, ArgSpan)> invoker_;
+        // Used by CallPlan once the types have been validated
+        UncheckedInvoker uncheckedInvoker_;
 
         MemberFunction(std::string name, const Type* retType, std::vector<const Type*> argTypes,
-                      std::function<Any(Any&, const std::vector<Any>&)> invoker);
+                      Thunk<Any(Any&, ArgSpan)> invoker, const Type* classType = nullptr,
+                      UncheckedInvoker uncheckedInvoker = nullptr, bool isConst = false);
         MemberFunction(MemberFunction&& other) noexcept;
 
         // Invoke the member function through Any
         Any Invoke(Any& instance, const std::vector<Any>& args) const;
 
+        // Invoke with argument views; makes no allocation unless the result does
+        Any Invoke(Any& instance, ArgSpan args) const;
+
+        // Calls the function on instances[0, count) with the same arguments. Types and the
+        // constness of every instance are checked up front (std::runtime_error before any call
+        // is made, and before the pool is involved), then each call goes
+        // through the typed invoker. results, if not null, receives count return values.
+        // With options.pool the range is split across the pool; the function must then be
+        // safe to run concurrently on distinct instances.
+        void InvokeBatch(Any* instances, size_t count, ArgSpan args, Any* results = nullptr,
+                         const BatchOptions& options = {}) const;
+        // Same, over a vector; results (if given) is resized to instances.size()
+        void InvokeBatch(std::vector<Any>& instances, ArgSpan args, std::vector<Any>* results = nullptr,
+                         const BatchOptions& options = {}) const;
+
         template <typename FuncPtr>
         static MemberFunction Create(const std::string& name, FuncPtr funcPtr) {
             using Traits = my_reflect::static_refl::function_traits<FuncPtr>;
@@ -42,13 +77,21 @@ namespace my_reflect::dynamic_refl {
             using ClassType = typename Traits::class_type;
 
             // Create type-erased invoker
-            auto invoker = [funcPtr](Any& instance, const std::vector<Any>& args) -> Any {
+            auto invoker = [funcPtr](Any& instance, ArgSpan args) -> Any {
                 return InvokeImpl<FuncPtr, ArgTypes>(funcPtr, instance, args, std::make_index_sequence<ArgTypes::size>{});
             };
+            auto uncheckedInvoker = [funcPtr](void* instance, const AnyView* args) -> Any {
+                return InvokeUnchecked<FuncPtr, ArgTypes>(funcPtr, instance, args, std::make_index_sequence<ArgTypes::size>{});
+            };
 
-            return MemberFunction{name, GetType<RetType>(), TypeListToVector<ArgTypes>(), std::move(invoker)};
+            return MemberFunction{name, GetType<RetType>(), TypeListToVector<ArgTypes>(), std::move(invoker),
+                                  GetType<ClassType>(), std::move(uncheckedInvoker), Traits::is_const};
         }
     private:
+        // Why this function cannot be called on instance (wrong type, or a ConstRef instance for
+        // a non-const function); empty if it can. Shared by Invoke and InvokeBatch.
+        std::string InstanceError(const Any& instance) const;
+
         template <typename TypeList>
         static std::vector<const Type*> TypeListToVector() {
             return TypeListToVectorImpl<TypeList>(std::make_index_sequence<TypeList::size>{});
@@ -61,9 +104,9 @@ namespace my_reflect::dynamic_refl {
 
         // Helper to extract a single argument
         template <typename ArgType>
-        static decltype(auto) ExtractArg(const Any& arg) {
+        static decltype(auto) ExtractArg(const AnyView& arg) {
             using PlainType = std::remove_cv_t<std::remove_reference_t<ArgType>>;
-            const PlainType* ptr = any_cast<PlainType>(arg);
+            const PlainType* ptr = view_cast<PlainType>(arg);
             if (!ptr) {
                 throw std::runtime_error("Failed to cast argument to correct type");
             }
@@ -72,7 +115,7 @@ namespace my_reflect::dynamic_refl {
 
         // Implementation for invoking member functions
         template <typename FuncPtr, typename ArgTypes, size_t... Is>
-        static Any InvokeImpl(FuncPtr funcPtr, Any& instance, const std::vector<Any>& args, std::index_sequence<Is...>) {
+        static Any InvokeImpl(FuncPtr funcPtr, Any& instance, ArgSpan args, std::index_sequence<Is...>) {
             using Traits = my_reflect::static_refl::function_traits<FuncPtr>;
             using ClassType = typename Traits::class_type;
             using RetType = typename Traits::return_type;
@@ -89,18 +132,85 @@ namespace my_reflect::dynamic_refl {
             }
 
             // Extract arguments and invoke
+            return MakeResult<RetType>([&]() -> RetType {
+                return (inst->*funcPtr)(ExtractArg<static_refl::get_t<ArgTypes, Is>>(args[Is])...);
+            });
+        }
+
+        template <typename FuncPtr, typename ArgTypes, size_t... Is>
+        static Any InvokeUnchecked(FuncPtr funcPtr, void* instance, const AnyView* args, std::index_sequence<Is...>) {
+            using Traits = my_reflect::static_refl::function_traits<FuncPtr>;
+            using ClassType = typename Traits::class_type;
+            using RetType = typename Traits::return_type;
+
+            auto* inst = static_cast<ClassType*>(instance);
+            return MakeResult<RetType>([&]() -> RetType {
+                return (inst->*funcPtr)(*static_cast<const std::remove_cv_t<std::remove_reference_t<
+                    static_refl::get_t<ArgTypes, Is>>>*>(args[Is].payload)...);
+            });
+        }
+
+        // Wraps what call() returns without copying it: lvalue references become Ref/ConstRef
+        // views of the referenced object (valid as long as it is), values are built in place
+        // in the result, rvalue references are moved from. void gives an empty Any.
+        template <typename RetType, typename Call>
+        static Any MakeResult(Call&& call) {
             if constexpr (std::is_void_v<RetType>) {
-                (inst->*funcPtr)(ExtractArg<static_refl::get_t<ArgTypes, Is>>(args[Is])...);
-                return Any{}; // Return empty Any for void functions
+                call();
+                return Any{};
+            } else if constexpr (std::is_lvalue_reference_v<RetType>) {
+                if constexpr (std::is_const_v<std::remove_reference_t<RetType>>) {
+                    return make_cref(call());
+                } else {
+                    return make_ref(call());
+                }
             } else {
-                RetType result = (inst->*funcPtr)(ExtractArg<static_refl::get_t<ArgTypes, Is>>(args[Is])...);
-                return make_copy(result);
+                return make_in_place<std::remove_cv_t<std::remove_reference_t<RetType>>>(std::forward<Call>(call));
             }
         }
     };
 
-}
+    /**
+     * @brief A call to one MemberFunction with fixed instance and argument types.
+     *
+     * The types are checked once, when the plan is built (std::runtime_error on mismatch).
+     * operator() then goes straight to the typed invoker: no any_cast of the instance, no
+     * argument count check and no per-argument view_cast. Passing values of other types
+     * than the plan was built for is undefined behavior (asserted in debug builds).
+     *
+     * Usage:
+     * @code
+     * const MemberFunction* add = GetType<Counter>()->AsClass()->FindFunction("add");
+     * CallPlan plan(*add, GetType<Counter>(), {GetType<int>()});
+     * int delta = 1;
+     * Any result = plan(counterAny, make_view(delta));
+     * @endcode
+     */
+    class CallPlan {
+    public:
+        CallPlan(const MemberFunction& function, const Type* instanceType, std::vector<const Type*> argTypes);
 
-// Include Any.h at the end for template implementations
-#include "Any.h"
+        Any operator()(Any& instance, ArgSpan args) const {
+            assert(instance.typeInfo == function_->classType_ && args.size() == function_->argTypes_.size());
+            assert(function_->isConst_ || instance.storage() != Any::storage_type::ConstRef);
+            assert(ArgumentsMatch(args));
+            return function_->uncheckedInvoker_(instance.payload, args.begin());
+        }
+
+        template <typename... Views>
+        Any operator()(Any& instance, const Views&... args) const {
+            static_assert((std::is_same_v<Views, AnyView> && ...), "CallPlan arguments are AnyView (see make_view)");
+            std::array<AnyView, sizeof...(Views)> views{args...};
+            return (*this)(instance, ArgSpan(views.data(), views.size()));
+        }
+
+        const MemberFunction& GetFunction() const { return *function_; }
+
+    private:
+        bool ArgumentsMatch(ArgSpan args) const;
+
+        const MemberFunction* function_;
+    };
+
+}
 
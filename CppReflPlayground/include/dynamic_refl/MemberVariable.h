@@ -4,7 +4,11 @@
 
 #pragma once
 #include <string>
+#include <type_traits>
 #include "Type.h"
+#include "Any.h"
+#include "Thunk.h"
+#include "dynamic_refl_util.h"
 #include "../static_refl/variable_traits.h"
 
 namespace my_reflect::dynamic_refl {
@@ -12,12 +16,52 @@ namespace my_reflect::dynamic_refl {
     // Forward declaration
     template <typename T>
     const Type* GetType();
+
+    // Typed access to a data member, captured from its member pointer
+    struct MemberAccessor {
+        // Returns a Ref (ConstRef when readOnly) Any viewing the member inside instance, no copy
+        Thunk<Any(void* instance, bool readOnly)> get = nullptr;
+        // Assigns value to the member; false if value holds a different type
+        Thunk<bool(void* instance, const Any& value)> set = nullptr;
+        // Byte offset of the member inside a live instance (set together with get)
+        Thunk<size_t(const void* instance)> offset = nullptr;
+
+        template <typename ClassT, typename V>
+        static MemberAccessor Create(V ClassT::* ptr) {
+            MemberAccessor accessor;
+            accessor.offset = [ptr](const void* instance) -> size_t {
+                return utils::MemberOffset(*static_cast<const ClassT*>(instance), ptr);
+            };
+            accessor.get = [ptr](void* instance, bool readOnly) -> Any {
+                auto& member = static_cast<ClassT*>(instance)->*ptr;
+                if constexpr (std::is_const_v<V>) {
+                    return make_cref(member);
+                } else {
+                    return readOnly ? make_cref(member) : make_ref(member);
+                }
+            };
+            if constexpr (std::is_copy_assignable_v<V>) {
+                accessor.set = [ptr](void* instance, const Any& value) -> bool {
+                    auto* v = any_cast<std::remove_cv_t<V>>(value);
+                    if (!v) {
+                        return false;
+                    }
+                    static_cast<ClassT*>(instance)->*ptr = *v;
+                    return true;
+                };
+            }
+            return accessor;
+        }
+    };
+
     class MemberVariable {
     public:
         std::string name_;
         const Type* type_;
+        // Empty when registered by type only (Add<decltype(&T::x)>("x"))
+        MemberAccessor accessor_;
 
-        MemberVariable(std::string name, const Type* type);
+        MemberVariable(std::string name, const Type* type, MemberAccessor accessor = {});
         MemberVariable(MemberVariable&& other) noexcept;
 
         template <typename T>
@@ -25,5 +69,11 @@ namespace my_reflect::dynamic_refl {
             using V_Type = typename my_reflect::static_refl::variable_traits<T>::type;
             return MemberVariable{name, GetType<V_Type>()};
         }
+
+        template <typename T>
+        static MemberVariable Create(const std::string& name, T ptr) {
+            using V_Type = typename my_reflect::static_refl::variable_traits<T>::type;
+            return MemberVariable{name, GetType<V_Type>(), MemberAccessor::Create(ptr)};
+        }
     };
 }
@@ -0,0 +1,52 @@
+//
+// Created by qianq on 1/4/2026.
+//
+// Open-addressing hash index from member (or enumerator) name to its position
+
+#pragma once
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace my_reflect::dynamic_refl {
+
+    class NameIndex {
+    public:
+        enum class Kind : uint8_t {
+            Function, Variable, Container, Enumerator
+        };
+
+        static constexpr int npos = -1;
+
+        // Map name to index for the given member kind; the first insertion of a name wins
+        void Insert(std::string_view name, Kind kind, uint32_t index);
+
+        // Return the index registered for name, or npos. Never allocates.
+        int Find(std::string_view name, Kind kind) const;
+
+        // Number of Insert calls for the given kind, duplicates included
+        size_t Count(Kind kind) const;
+
+        void Clear();
+
+    private:
+        struct Slot {
+            uint64_t hash = 0;
+            std::string name;
+            uint32_t index = 0;
+            Kind kind = Kind::Function;
+            bool used = false;
+        };
+
+        // Slot count is a power of two, kept at most half full
+        std::vector<Slot> slots_;
+        size_t used_ = 0;
+        size_t counts_[4] = {0, 0, 0, 0};
+
+        void Grow();
+        void Place(Slot&& slot);
+        static uint64_t Hash(std::string_view name, Kind kind);
+    };
+
+}
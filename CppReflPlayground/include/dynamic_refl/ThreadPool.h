@@ -0,0 +1,76 @@
+//
+// Created by qianq on 1/5/2026.
+//
+// Fixed set of worker threads for splitting index ranges (used by MemberFunction::InvokeBatch)
+
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace my_reflect::dynamic_refl {
+
+    class ThreadPool {
+    public:
+        // Runs one chunk [begin, end) of a ParallelFor; context is passed through unchanged
+        using RangeFunction = void (*)(void* context, size_t begin, size_t end);
+
+        // workerCount background threads; the thread calling ParallelFor also takes chunks
+        explicit ThreadPool(size_t workerCount = DefaultWorkerCount());
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        size_t GetWorkerCount() const { return workers_.size(); }
+
+        // Calls body(context, begin, end) for chunks covering [0, count), each at least minChunk
+        // long (except the last). Blocks until every chunk has run. If a chunk throws, the
+        // remaining chunks are skipped and the first exception is rethrown here.
+        // One ParallelFor runs at a time; concurrent callers wait. A ParallelFor issued from
+        // inside one of this pool's chunks (on a worker or on the calling thread) runs inline.
+        void ParallelFor(size_t count, size_t minChunk, RangeFunction body, void* context);
+
+        // Same, for any callable body(begin, end). The callable is referenced, not copied.
+        template <typename Body, typename = std::enable_if_t<std::is_invocable_v<Body&, size_t, size_t>>>
+        void ParallelFor(size_t count, size_t minChunk, Body&& body) {
+            using Callable = std::remove_reference_t<Body>;
+            ParallelFor(count, minChunk, [](void* context, size_t begin, size_t end) {
+                (*static_cast<Callable*>(context))(begin, end);
+            }, const_cast<void*>(static_cast<const void*>(std::addressof(body))));
+        }
+
+        static size_t DefaultWorkerCount();
+
+    private:
+        void WorkerLoop();
+        void RunChunks();
+        bool IsRunningOnThisThread() const;
+
+        std::vector<std::thread> workers_;
+        std::mutex submitMutex_;
+
+        std::mutex mutex_;
+        std::condition_variable wake_;
+        std::condition_variable done_;
+        uint64_t generation_ = 0;
+        size_t busyWorkers_ = 0;
+        bool stop_ = false;
+
+        // Current job, published under mutex_
+        RangeFunction body_ = nullptr;
+        void* context_ = nullptr;
+        size_t count_ = 0;
+        size_t chunk_ = 0;
+        std::atomic<size_t> next_{0};
+        std::exception_ptr error_;
+    };
+
+}
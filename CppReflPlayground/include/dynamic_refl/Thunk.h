@@ -0,0 +1,54 @@
+//
+// Created by qianq on 1/3/2026.
+//
+// Lightweight type-erased callable: a plain function pointer plus an inline
+// capture slot. Replaces std::function for reflection invokers, which never
+// capture more than a member pointer: no allocation, one indirect call.
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace my_reflect::dynamic_refl {
+
+template <typename Signature>
+class Thunk;
+
+template <typename R, typename... Args>
+class Thunk<R(Args...)> {
+public:
+	// Large enough for any member function pointer (up to 3 words on MSVC)
+	static constexpr size_t capture_size = 3 * sizeof(void*);
+
+	using function_type = R(*)(const void* context, Args...);
+
+	Thunk() = default;
+	Thunk(std::nullptr_t) {}
+
+	// Wrap a callable whose captures are trivially copyable and fit the capture slot
+	template <typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, Thunk>>>
+	Thunk(F callable) {
+		static_assert(std::is_trivially_copyable_v<F>, "Thunk captures must be trivially copyable");
+		static_assert(sizeof(F) <= capture_size && alignof(F) <= alignof(void*),
+			"Thunk captures must fit the inline capture slot");
+		new (context_) F(callable);
+		function_ = [](const void* context, Args... args) -> R {
+			return (*static_cast<const F*>(context))(std::forward<Args>(args)...);
+		};
+	}
+
+	explicit operator bool() const { return function_ != nullptr; }
+
+	R operator()(Args... args) const {
+		return function_(context_, std::forward<Args>(args)...);
+	}
+
+private:
+	function_type function_ = nullptr;
+	alignas(void*) unsigned char context_[capture_size] = {};
+};
+
+} // namespace my_reflect::dynamic_refl
@@ -3,12 +3,15 @@
 //
 
 #pragma once
+#include <cstdint>
 #include <string>
 namespace my_reflect::dynamic_refl {
     class Enum;
     class Arithmetic;
     class Class;
 
+    // Dense per-process type identifier, assigned when a Type is first created. 0 means "no type".
+    using TypeId = uint32_t;
 
     class Type {
     public:
@@ -23,6 +26,7 @@ namespace my_reflect::dynamic_refl {
         const std::string& GetName() const { return name_; }
         void SetName(const std::string& name) { name_ = name; }
         const Kind GetKind() const { return kind_; }
+        TypeId GetId() const { return id_; }
 
         const Arithmetic* AsArithmetic() const;
         const Enum* AsEnum() const;
@@ -31,5 +35,6 @@ namespace my_reflect::dynamic_refl {
     protected:
         std::string name_;
         Kind kind_;
+        TypeId id_;
     };
 }
@@ -2,34 +2,82 @@
 // Created by qianq on 12/30/2025.
 //
 // Singleton registry to store all type information
+//
+// Thread safety: lookups are wait-free and may run concurrently with
+// registration. Registrations are serialized by a mutex and published to
+// readers through an insert-only hash table of interned names.
 
 #pragma once
 #include "Type.h"
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <string>
+#include <string_view>
+#include <vector>
 
 namespace my_reflect::dynamic_refl {
 
+    // A registry-owned copy of a type name with its precomputed hash.
+    // The view stays valid for the lifetime of the program.
+    struct InternedName {
+        std::string_view name;
+        uint64_t hash = 0;
+    };
+
     class TypeRegistry {
     public:
         static TypeRegistry& Instance();
 
         // Register a type with its name
         // Returns early if already registered
-        void RegisterType(const std::string& name, Type* type);
+        void RegisterType(std::string_view name, Type* type);
+
+        // Lookup type by name, wait-free and allocation-free
+        Type* GetTypeByName(std::string_view name) const;
+
+        // Lookup with a name interned earlier, skipping the hash computation
+        Type* GetTypeByName(const InternedName& name) const;
 
-        // Lookup type by name
-        Type* GetTypeByName(const std::string& name) const;
+        // Return the registry's stable copy of name, adding it if needed
+        InternedName Intern(std::string_view name);
 
-        // Get all registered types
-        const std::unordered_map<std::string, Type*>& GetAllTypes() const;
+        // Snapshot of all registered types
+        std::unordered_map<std::string, Type*> GetAllTypes() const;
 
         TypeRegistry(const TypeRegistry&) = delete;
         TypeRegistry& operator=(const TypeRegistry&) = delete;
     private:
-        TypeRegistry() = default;
+        TypeRegistry();
+        ~TypeRegistry();
+
+        struct Entry {
+            InternedName key;
+            std::atomic<Type*> type{nullptr};
+        };
+
+        // Insert-only open-addressing table; capacity is a power of two, at most half full
+        struct Table {
+            explicit Table(size_t capacity);
+            size_t capacity;
+            std::unique_ptr<std::atomic<Entry*>[]> slots;
+        };
+
+        Entry* Find(const Table& table, std::string_view name, uint64_t hash) const;
+        // Requires mutex_ held
+        Entry* FindOrInsert(std::string_view name, uint64_t hash);
+
+        std::atomic<Table*> table_;
 
-        std::unordered_map<std::string, Type*> types_;
+        // Writer-side state, guarded by mutex_
+        mutable std::mutex mutex_;
+        size_t count_ = 0;
+        std::deque<std::string> names_;           // interned name storage, never moves
+        std::deque<Entry> entries_;               // stable entry storage
+        std::vector<std::unique_ptr<Table>> tables_;  // current and retired tables, kept for readers
     };
 
 }
@@ -2,7 +2,7 @@
 // Created by qianq on 1/1/2026.
 //
 // Container operations for Any type
-// Provides generic operations for std::vector, std::set, std::map wrapped in Any
+// Provides generic operations for the standard containers in static_refl::ContainerKind wrapped in Any
 
 #pragma once
 
@@ -25,21 +25,105 @@ namespace container_ops {
     // Clear container
     void Clear(const MemberContainer& containerInfo, Any& container);
 
-    // Push element to vector or insert to set
+    // Push element to vector/deque or insert to set
     bool Push(const MemberContainer& containerInfo, Any& container, const Any& value);
 
-    // Get element at index (vector only)
+    // Push or insert by moving: a value that owns its payload (Copy/Move storage, e.g. from
+    // make_copy/make_move) is moved into the container and left empty. Ref/ConstRef values are
+    // copied and left as they are. A set that already holds an equal element leaves value as it is.
+    bool PushMove(const MemberContainer& containerInfo, Any& container, Any&& value);
+
+    // Get element at index (vector, deque, array)
     Any At(const MemberContainer& containerInfo, const Any& container, size_t index);
 
     // Insert key-value pair into map
     bool InsertKV(const MemberContainer& containerInfo, Any& map, const Any& key, const Any& value);
 
+    // Insert or assign key -> value, moving owned payloads like PushMove (the value is never
+    // default-constructed first)
+    bool EmplaceKV(const MemberContainer& containerInfo, Any& map, Any&& key, Any&& value);
+
+    // Insert key -> value only if key is absent. Returns false, leaving key and value untouched,
+    // if the key is already present (or the types do not match).
+    bool TryEmplace(const MemberContainer& containerInfo, Any& map, Any&& key, Any&& value);
+
     // Get value by key from map
     Any GetValue(const MemberContainer& containerInfo, const Any& map, const Any& key);
 
-    // Check if map contains key
+    // Check if map contains key (or set contains value); hashed for unordered containers
     bool ContainsKey(const MemberContainer& containerInfo, const Any& map, const Any& key);
 
+    // ========== Bulk access (vector, deque, array) ==========
+
+    // Element block of a vector/array of trivially copyable elements (data, element type, stride, count)
+    ContiguousBlock Contiguous(const MemberContainer& containerInfo, const Any& container);
+
+    void Reserve(const MemberContainer& containerInfo, Any& container, size_t capacity);
+
+    void Resize(const MemberContainer& containerInfo, Any& container, size_t size);
+
+    // Replace the contents with count elements of elementType copied from data, in one range
+    // copy. data may point into the container itself; such ranges are copied out first.
+    // Returns false if elementType is not the vector's element type.
+    bool AssignRange(const MemberContainer& containerInfo, Any& container,
+                     const void* data, size_t count, const Type* elementType);
+
+    // Same as AssignRange, but appends after the existing elements
+    bool AppendRange(const MemberContainer& containerInfo, Any& container,
+                     const void* data, size_t count, const Type* elementType);
+
+    template <typename T>
+    bool AssignRange(const MemberContainer& containerInfo, Any& container, const T* data, size_t count) {
+        return AssignRange(containerInfo, container, static_cast<const void*>(data), count, GetType<T>());
+    }
+
+    template <typename T>
+    bool AppendRange(const MemberContainer& containerInfo, Any& container, const T* data, size_t count) {
+        return AppendRange(containerInfo, container, static_cast<const void*>(data), count, GetType<T>());
+    }
+
+    // ========== Iteration (no Any per element) ==========
+
+    // Cursor at the first element; cursor.valid is false for an empty container.
+    //   for (auto c = Begin(info, any); c.valid; Next(info, c)) { use(c.element); }
+    ContainerCursor Begin(const MemberContainer& containerInfo, const Any& container);
+
+    // Advance to the next element; returns cursor.valid. Inline for contiguous containers.
+    inline bool Next(const MemberContainer& containerInfo, ContainerCursor& cursor) {
+        if (cursor.stride != 0) {
+            return cursor.StepContiguous();
+        }
+        return containerInfo.ops_.next(cursor);
+    }
+
+    // Call callback(const ContainerElement&) for each element in container order, in one
+    // native loop. A callback returning false stops early. Returns the elements visited.
+    // Contiguous containers are walked here, calling callback directly (no indirect call per
+    // element); the others loop inside the container's for_each.
+    template <typename Callback>
+    size_t ForEach(const MemberContainer& containerInfo, const Any& container, Callback&& callback) {
+        if (!containerInfo.ops_.for_each) {
+            throw std::runtime_error("Container does not support for_each operation");
+        }
+        if (static_refl::is_contiguous_kind(containerInfo.kind_)) {
+            ContainerCursor cursor = Begin(containerInfo, container);
+            if (!cursor.valid) {
+                return 0;
+            }
+            ContainerElement element = cursor.element;
+            const auto* first = static_cast<const unsigned char*>(element.value.payload);
+            const auto* end = static_cast<const unsigned char*>(cursor.end);
+            for (const unsigned char* at = first; at != end; at += cursor.stride) {
+                element.value.payload = const_cast<unsigned char*>(at);
+                if (!container_detail::CallOnElement(callback, element)) {
+                    return static_cast<size_t>(at - first) / cursor.stride + 1;
+                }
+            }
+            return static_cast<size_t>(end - first) / cursor.stride;
+        }
+        return containerInfo.ops_.for_each(container, ElementCallback(callback));
+    }
+
 } // namespace container_ops
 
 } // namespace my_reflect::dynamic_refl
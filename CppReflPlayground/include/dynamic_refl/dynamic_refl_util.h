@@ -4,9 +4,48 @@
 // Utility functions for dynamic reflection
 
 #pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include "../static_refl/name_hash.h"
 
 namespace my_reflect::dynamic_refl::utils {
 
-    // Utility functions will be added here
+    // 64-bit FNV-1a hash, usable at compile time (same hash as the static name tables)
+    constexpr uint64_t HashName(std::string_view name) {
+        return static_refl::hash_name(name);
+    }
+
+    // Byte offset of a data member inside a live object. Offsets are measured on real
+    // instances only: forming a member address on storage with no object in it is UB.
+    template <typename ClassT, typename V>
+    size_t MemberOffset(const ClassT& object, V ClassT::* ptr) {
+        return reinterpret_cast<const unsigned char*>(std::addressof(object.*ptr))
+             - reinterpret_cast<const unsigned char*>(std::addressof(object));
+    }
+
+    // True when Base is an unambiguous, non-virtual base of Derived (the only case in which
+    // the downcast is well-formed), i.e. when Base sits at the same offset in every Derived
+    template <typename Derived, typename Base, typename = void>
+    struct is_fixed_base : std::false_type {};
+
+    template <typename Derived, typename Base>
+    struct is_fixed_base<Derived, Base,
+                         std::void_t<decltype(static_cast<const Derived*>(std::declval<const Base*>()))>>
+        : std::true_type {};
+
+    template <typename Derived, typename Base>
+    inline constexpr bool is_fixed_base_v = is_fixed_base<Derived, Base>::value;
+
+    // Byte offset of the Base subobject inside a live Derived
+    template <typename Derived, typename Base>
+    size_t BaseOffset(const void* instance) {
+        const auto* object = static_cast<const Derived*>(instance);
+        return reinterpret_cast<const unsigned char*>(static_cast<const Base*>(object))
+             - reinterpret_cast<const unsigned char*>(object);
+    }
 
 }
@@ -51,12 +51,12 @@ namespace my_reflect::dynamic_refl {
     }
 
     // Lookup type by name from registry
-    inline Type* GetType(const std::string& name) {
+    inline Type* GetType(std::string_view name) {
         return TypeRegistry::Instance().GetTypeByName(name);
     }
 
-    // Get all registered types
-    inline const std::unordered_map<std::string, Type*>& GetAllTypes() {
+    // Get a snapshot of all registered types
+    inline std::unordered_map<std::string, Type*> GetAllTypes() {
         return TypeRegistry::Instance().GetAllTypes();
     }
 
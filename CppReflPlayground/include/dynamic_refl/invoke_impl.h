@@ -7,29 +7,13 @@
 #pragma once
 
 #include "Any.h"
+#include "AnyView.h"
 #include "Class.h"
-#include <vector>
+#include <array>
 #include <stdexcept>
 
 namespace my_reflect::dynamic_refl {
 
-// Helper to convert variadic args to vector<Any>
-// Uses make_ref for lvalue references, make_copy for rvalues
-namespace detail {
-    inline void pack_args(std::vector<Any>&) {}
-
-    template<typename T, typename... Rest>
-    void pack_args(std::vector<Any>& vec, T&& arg, Rest&&... rest) {
-        // For lvalue references, use make_ref; for rvalues, use make_copy
-        if constexpr (std::is_lvalue_reference_v<T>) {
-            vec.push_back(make_ref(arg));
-        } else {
-            vec.push_back(make_copy(std::forward<T>(arg)));
-        }
-        pack_args(vec, std::forward<Rest>(rest)...);
-    }
-}
-
 // Invoke member function by name
 template<typename... Args>
 Any Any::invoke(const std::string& funcName, Args&&... args) {
@@ -54,12 +38,11 @@ Any Any::invoke(const std::string& funcName, Args&&... args) {
         throw std::runtime_error("Function not found: " + funcName);
     }
 
-    // Pack arguments into vector<Any>
-    std::vector<Any> anyArgs;
-    detail::pack_args(anyArgs, std::forward<Args>(args)...);
+    // View arguments in place; they outlive the call, so nothing is boxed or copied
+    std::array<AnyView, sizeof...(Args)> argViews{make_view(args)...};
 
     // Invoke the function
-    return func->Invoke(*this, anyArgs);
+    return func->Invoke(*this, ArgSpan(argViews));
 }
 
 // Invoke member function by index
@@ -81,18 +64,17 @@ Any Any::invoke(size_t funcIndex, Args&&... args) {
     }
 
     // Check index bounds
-    if (funcIndex >= classInfo->memberFunctions_.size()) {
+    if (funcIndex >= classInfo->GetMemberFunctions().size()) {
         throw std::out_of_range("Function index out of range");
     }
 
-    const MemberFunction* func = &classInfo->memberFunctions_[funcIndex];
+    const MemberFunction* func = &classInfo->GetMemberFunctions()[funcIndex];
 
-    // Pack arguments into vector<Any>
-    std::vector<Any> anyArgs;
-    detail::pack_args(anyArgs, std::forward<Args>(args)...);
+    // View arguments in place; they outlive the call, so nothing is boxed or copied
+    std::array<AnyView, sizeof...(Args)> argViews{make_view(args)...};
 
     // Invoke the function
-    return func->Invoke(*this, anyArgs);
+    return func->Invoke(*this, ArgSpan(argViews));
 }
 
 } // namespace my_reflect::dynamic_refl
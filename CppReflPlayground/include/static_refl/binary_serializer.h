@@ -0,0 +1,465 @@
+//
+// Created by qianq on 1/4/2026.
+//
+// Compact binary encoder/decoder generated entirely from TypeData<T>.
+//
+// Wire format (native byte order, no field names, no padding):
+//   reflected class     -> base classes (BASE_CLASSES order), then variables, then containers;
+//                          raw fields adjacent in memory are copied as one block
+//   trivially copyable  -> raw object bytes (arithmetic, enums, pointers, plain structs)
+//   std::string         -> uint64 length + characters
+//   std::vector<T>      -> uint64 count + elements (one memcpy block when T is trivially copyable)
+//   std::deque<T>       -> uint64 count + elements
+//   std::set/unordered_set<T>      -> uint64 count + elements (in iteration order)
+//   std::map/unordered_map<K, V>   -> uint64 count + (key, value) pairs (in iteration order)
+//   std::array<T, N>    -> N elements, no count (raw bytes when trivially copyable)
+//
+// Static (non-member) variables are not part of an instance and are skipped.
+// Pointers are written as raw addresses, so they only round-trip within one process.
+
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "reflect_core.h"
+
+namespace my_reflect::static_refl::utils {
+
+    // Length/count prefix used by strings and containers
+    using binary_size_t = uint64_t;
+
+    // Append-only output buffer. Reuse one writer across encodes to keep its capacity.
+    class BinaryWriter {
+    public:
+        void write(const void* data, size_t size) {
+            const auto* bytes = static_cast<const std::byte*>(data);
+            buffer_.insert(buffer_.end(), bytes, bytes + size);
+        }
+
+        void write_size(size_t size) {
+            binary_size_t prefix = size;
+            write(&prefix, sizeof(prefix));
+        }
+
+        // Grows geometrically, so repeated small reserves stay amortized O(1)
+        void reserve(size_t extra) {
+            size_t needed = buffer_.size() + extra;
+            if (needed > buffer_.capacity()) {
+                buffer_.reserve(needed > 2 * buffer_.capacity() ? needed : 2 * buffer_.capacity());
+            }
+        }
+        void clear() { buffer_.clear(); }
+        size_t size() const { return buffer_.size(); }
+        const std::vector<std::byte>& buffer() const { return buffer_; }
+        std::vector<std::byte> release() { return std::move(buffer_); }
+
+    private:
+        std::vector<std::byte> buffer_;
+    };
+
+    // Bounds-checked cursor over encoded bytes; throws std::runtime_error on malformed input
+    class BinaryReader {
+    public:
+        BinaryReader(const void* data, size_t size)
+            : data_(static_cast<const std::byte*>(data)), size_(size) {}
+
+        explicit BinaryReader(const std::vector<std::byte>& buffer)
+            : BinaryReader(buffer.data(), buffer.size()) {}
+
+        void read(void* out, size_t size) {
+            if (size > remaining()) {
+                throw std::runtime_error("Binary decode: unexpected end of input");
+            }
+            if (size != 0) {
+                std::memcpy(out, data_ + pos_, size);
+            }
+            pos_ += size;
+        }
+
+        // Reads a count prefix, rejecting counts the remaining input cannot hold
+        size_t read_size(size_t minElementSize) {
+            binary_size_t prefix = 0;
+            read(&prefix, sizeof(prefix));
+            if (minElementSize != 0 && prefix > remaining() / minElementSize) {
+                throw std::runtime_error("Binary decode: element count exceeds input size");
+            }
+            return static_cast<size_t>(prefix);
+        }
+
+        size_t remaining() const { return size_ - pos_; }
+        bool done() const { return pos_ == size_; }
+
+    private:
+        const std::byte* data_;
+        size_t size_;
+        size_t pos_ = 0;
+    };
+
+    namespace detail {
+        template <typename T>
+        constexpr bool dependent_false_v = false;
+
+        // TypeData<T> only defines the lists the BEGIN_REFLECT block spelled out
+        template <typename T, typename = void>
+        struct has_variables : std::false_type {};
+
+        template <typename T>
+        struct has_variables<T, std::void_t<decltype(TypeData<T>::variables)>> : std::true_type {};
+
+        template <typename T, typename = void>
+        struct has_containers : std::false_type {};
+
+        template <typename T>
+        struct has_containers<T, std::void_t<decltype(TypeData<T>::containers)>> : std::true_type {};
+
+        template <typename T, typename = void>
+        struct base_types_of { using type = type_list<>; };
+
+        template <typename T>
+        struct base_types_of<T, std::void_t<typename TypeData<T>::base_types>> {
+            using type = typename TypeData<T>::base_types;
+        };
+
+        template <typename T>
+        constexpr bool is_reflected_v = has_variables<T>::value || has_containers<T>::value
+            || base_types_of<T>::type::size > 0;
+
+        // Encoded as raw bytes: trivially copyable and not walked field by field
+        template <typename T>
+        constexpr bool is_raw_v = std::is_trivially_copyable_v<T> && !is_reflected_v<T>;
+
+        template <typename T>
+        constexpr bool is_string_v = false;
+
+        template <typename C, typename Tr, typename A>
+        constexpr bool is_string_v<std::basic_string<C, Tr, A>> = is_raw_v<C>;
+
+        template <typename T>
+        constexpr bool is_container_kind(ContainerKind kind) {
+            if constexpr (is_container_v<T>) {
+                return container_kind_v<T> == kind;
+            } else {
+                return false;
+            }
+        }
+
+        // is_container_kind for a group of kinds (is_set_kind, is_map_kind, ...)
+        template <typename T>
+        constexpr bool is_container_kind(bool (*group)(ContainerKind)) {
+            if constexpr (is_container_v<T>) {
+                return group(container_kind_v<T>);
+            } else {
+                return false;
+            }
+        }
+
+        // Value type of a member pointer (void for static variable pointers)
+        template <typename P>
+        struct member_value { using type = void; };
+
+        template <typename C, typename V>
+        struct member_value<V C::*> { using type = V; };
+
+        template <typename Field>
+        using member_value_t = typename member_value<decltype(std::declval<Field>().ptr_)>::type;
+
+        // Smallest number of bytes any value of T encodes to. Used to size the
+        // output buffer up front and to validate element counts while decoding.
+        template <typename T>
+        constexpr size_t min_encoded_size();
+
+        template <typename Tuple, size_t... I>
+        constexpr size_t min_fields_size(std::index_sequence<I...>) {
+            size_t total = 0;
+            ((total += [] {
+                using Field = std::remove_cv_t<std::tuple_element_t<I, Tuple>>;
+                using Value = member_value_t<Field>;
+                if constexpr (std::is_void_v<Value>) {
+                    return size_t{0};
+                } else {
+                    return min_encoded_size<Value>();
+                }
+            }()), ...);
+            return total;
+        }
+
+        template <typename... Bases>
+        constexpr size_t min_bases_size(type_list<Bases...>) {
+            return (size_t{0} + ... + min_encoded_size<Bases>());
+        }
+
+        template <typename T>
+        constexpr size_t min_encoded_size() {
+            if constexpr (is_reflected_v<T>) {
+                size_t total = min_bases_size(typename base_types_of<T>::type{});
+                if constexpr (has_variables<T>::value) {
+                    using Vars = std::remove_cv_t<decltype(TypeData<T>::variables)>;
+                    total += min_fields_size<Vars>(std::make_index_sequence<std::tuple_size_v<Vars>>{});
+                }
+                if constexpr (has_containers<T>::value) {
+                    using Conts = std::remove_cv_t<decltype(TypeData<T>::containers)>;
+                    total += min_fields_size<Conts>(std::make_index_sequence<std::tuple_size_v<Conts>>{});
+                }
+                return total;
+            } else if constexpr (std::is_trivially_copyable_v<T>) {
+                return sizeof(T);
+            } else if constexpr (is_container_kind<T>(ContainerKind::Array)) {
+                return std::tuple_size_v<T> * min_encoded_size<typename T::value_type>();
+            } else {
+                return sizeof(binary_size_t); // strings and containers: just the prefix
+            }
+        }
+
+        template <typename T>
+        void encode_value(BinaryWriter& out, const T& value);
+
+        template <typename T>
+        void decode_value(BinaryReader& in, T& value);
+
+        template <typename T, typename... Bases>
+        void encode_bases(BinaryWriter& out, const T& obj, type_list<Bases...>) {
+            (encode_value(out, static_cast<const Bases&>(obj)), ...);
+        }
+
+        template <typename T, typename... Bases>
+        void decode_bases(BinaryReader& in, T& obj, type_list<Bases...>) {
+            (decode_value(in, static_cast<Bases&>(obj)), ...);
+        }
+
+        // Byte runs of a field list: runs[I] is the number of bytes copied starting at field I,
+        // which covers every following raw member field that sits right behind it in memory
+        // (0 if field I is not raw or was folded into an earlier run). Which fields are raw is
+        // known at compile time; offsets are not, so they are measured once on the first
+        // instance seen (the layout is the same for every instance of T).
+        template <typename T, typename Tuple>
+        const std::array<size_t, std::tuple_size_v<Tuple>>& raw_runs(const T& obj, const Tuple& fields) {
+            constexpr size_t count = std::tuple_size_v<Tuple>;
+            static const std::array<size_t, count> runs = [&] {
+                std::array<size_t, count> result{};
+                const auto* base = reinterpret_cast<const std::byte*>(std::addressof(obj));
+                size_t open = count; // field whose run is being extended, count if none
+                size_t runEnd = 0;   // offset just past that run
+                size_t index = 0;
+                std::apply([&](const auto&... field) {
+                    ([&](const auto& f) {
+                        using Field = std::decay_t<decltype(f)>;
+                        if constexpr (Field::is_member()) {
+                            using Value = std::remove_cv_t<member_value_t<Field>>;
+                            if constexpr (is_raw_v<Value>) {
+                                size_t offset = static_cast<size_t>(
+                                    reinterpret_cast<const std::byte*>(std::addressof(obj.*(f.ptr_))) - base);
+                                if (open != count && offset == runEnd) {
+                                    result[open] += sizeof(Value);
+                                } else {
+                                    open = index;
+                                    result[index] = sizeof(Value);
+                                }
+                                runEnd = offset + sizeof(Value);
+                            } else {
+                                open = count;
+                            }
+                        }
+                        ++index;
+                    }(field), ...);
+                }, fields);
+                return result;
+            }();
+            return runs;
+        }
+
+        template <typename T, typename Tuple>
+        void encode_fields(BinaryWriter& out, const T& obj, const Tuple& fields) {
+            const auto& runs = raw_runs(obj, fields);
+            size_t index = 0;
+            std::apply([&](const auto&... field) {
+                ([&](const auto& f) {
+                    using Field = std::decay_t<decltype(f)>;
+                    if constexpr (Field::is_member()) {
+                        if constexpr (is_raw_v<std::remove_cv_t<member_value_t<Field>>>) {
+                            if (runs[index] != 0) {
+                                out.write(std::addressof(obj.*(f.ptr_)), runs[index]);
+                            }
+                        } else {
+                            encode_value(out, obj.*(f.ptr_));
+                        }
+                    }
+                    ++index;
+                }(field), ...);
+            }, fields);
+        }
+
+        template <typename T, typename Tuple>
+        void decode_fields(BinaryReader& in, T& obj, const Tuple& fields) {
+            const auto& runs = raw_runs(obj, fields);
+            size_t index = 0;
+            std::apply([&](const auto&... field) {
+                ([&](const auto& f) {
+                    using Field = std::decay_t<decltype(f)>;
+                    if constexpr (Field::is_member()) {
+                        if constexpr (is_raw_v<std::remove_cv_t<member_value_t<Field>>>) {
+                            if (runs[index] != 0) {
+                                in.read(std::addressof(obj.*(f.ptr_)), runs[index]);
+                            }
+                        } else {
+                            decode_value(in, obj.*(f.ptr_));
+                        }
+                    }
+                    ++index;
+                }(field), ...);
+            }, fields);
+        }
+
+        template <typename T>
+        void encode_value(BinaryWriter& out, const T& value) {
+            if constexpr (is_reflected_v<T>) {
+                encode_bases(out, value, typename base_types_of<T>::type{});
+                if constexpr (has_variables<T>::value) {
+                    encode_fields(out, value, TypeData<T>::variables);
+                }
+                if constexpr (has_containers<T>::value) {
+                    encode_fields(out, value, TypeData<T>::containers);
+                }
+            } else if constexpr (std::is_trivially_copyable_v<T>) {
+                out.write(&value, sizeof(T));
+            } else if constexpr (is_string_v<T>) {
+                out.write_size(value.size());
+                out.write(value.data(), value.size() * sizeof(typename T::value_type));
+            } else if constexpr (is_container_kind<T>(ContainerKind::Vector)) {
+                using Elem = typename T::value_type;
+                out.write_size(value.size());
+                if constexpr (is_raw_v<Elem> && !std::is_same_v<Elem, bool>) {
+                    out.write(value.data(), value.size() * sizeof(Elem));
+                } else {
+                    for (const auto& elem : value) {
+                        encode_value(out, static_cast<const Elem&>(elem));
+                    }
+                }
+            } else if constexpr (is_container_kind<T>(ContainerKind::Array)) {
+                for (const auto& elem : value) {
+                    encode_value(out, elem);
+                }
+            } else if constexpr (is_container_kind<T>(is_set_kind) || is_container_kind<T>(ContainerKind::Deque)) {
+                out.write_size(value.size());
+                for (const auto& elem : value) {
+                    encode_value(out, elem);
+                }
+            } else if constexpr (is_container_kind<T>(is_map_kind)) {
+                out.write_size(value.size());
+                for (const auto& [key, mapped] : value) {
+                    encode_value(out, key);
+                    encode_value(out, mapped);
+                }
+            } else {
+                static_assert(dependent_false_v<T>, "Type is not binary serializable");
+            }
+        }
+
+        template <typename T>
+        void decode_value(BinaryReader& in, T& value) {
+            if constexpr (is_reflected_v<T>) {
+                decode_bases(in, value, typename base_types_of<T>::type{});
+                if constexpr (has_variables<T>::value) {
+                    decode_fields(in, value, TypeData<T>::variables);
+                }
+                if constexpr (has_containers<T>::value) {
+                    decode_fields(in, value, TypeData<T>::containers);
+                }
+            } else if constexpr (std::is_trivially_copyable_v<T>) {
+                in.read(&value, sizeof(T));
+            } else if constexpr (is_string_v<T>) {
+                using Char = typename T::value_type;
+                value.resize(in.read_size(sizeof(Char)));
+                in.read(value.data(), value.size() * sizeof(Char));
+            } else if constexpr (is_container_kind<T>(ContainerKind::Vector)) {
+                using Elem = typename T::value_type;
+                size_t count = in.read_size(min_encoded_size<Elem>());
+                if constexpr (is_raw_v<Elem> && !std::is_same_v<Elem, bool>) {
+                    value.resize(count);
+                    in.read(value.data(), count * sizeof(Elem));
+                } else {
+                    value.clear();
+                    value.reserve(count);
+                    for (size_t i = 0; i < count; ++i) {
+                        Elem elem{};
+                        decode_value(in, elem);
+                        value.push_back(std::move(elem));
+                    }
+                }
+            } else if constexpr (is_container_kind<T>(ContainerKind::Array)) {
+                for (auto& elem : value) {
+                    decode_value(in, elem);
+                }
+            } else if constexpr (is_container_kind<T>(ContainerKind::Deque)) {
+                using Elem = typename T::value_type;
+                size_t count = in.read_size(min_encoded_size<Elem>());
+                value.clear();
+                for (size_t i = 0; i < count; ++i) {
+                    Elem elem{};
+                    decode_value(in, elem);
+                    value.push_back(std::move(elem));
+                }
+            } else if constexpr (is_container_kind<T>(is_set_kind)) {
+                using Elem = typename T::value_type;
+                size_t count = in.read_size(min_encoded_size<Elem>());
+                value.clear();
+                for (size_t i = 0; i < count; ++i) {
+                    Elem elem{};
+                    decode_value(in, elem);
+                    value.emplace_hint(value.end(), std::move(elem));
+                }
+            } else if constexpr (is_container_kind<T>(is_map_kind)) {
+                using Key = typename T::key_type;
+                using Mapped = typename T::mapped_type;
+                size_t count = in.read_size(min_encoded_size<Key>() + min_encoded_size<Mapped>());
+                value.clear();
+                for (size_t i = 0; i < count; ++i) {
+                    Key key{};
+                    Mapped mapped{};
+                    decode_value(in, key);
+                    decode_value(in, mapped);
+                    value.emplace_hint(value.end(), std::move(key), std::move(mapped));
+                }
+            } else {
+                static_assert(dependent_false_v<T>, "Type is not binary serializable");
+            }
+        }
+    }
+
+    // Appends the encoding of obj to out
+    template <typename T>
+    void to_binary(const T& obj, BinaryWriter& out) {
+        out.reserve(detail::min_encoded_size<T>());
+        detail::encode_value(out, obj);
+    }
+
+    template <typename T>
+    std::vector<std::byte> to_binary(const T& obj) {
+        BinaryWriter out;
+        to_binary(obj, out);
+        return out.release();
+    }
+
+    // Decodes the next value from in into obj (fields not in TypeData are left untouched)
+    template <typename T>
+    void from_binary(T& obj, BinaryReader& in) {
+        detail::decode_value(in, obj);
+    }
+
+    // Decodes a whole buffer produced by to_binary; trailing bytes are an error
+    template <typename T>
+    void from_binary(T& obj, const std::vector<std::byte>& data) {
+        BinaryReader in(data);
+        detail::decode_value(in, obj);
+        if (!in.done()) {
+            throw std::runtime_error("Binary decode: trailing bytes after value");
+        }
+    }
+}
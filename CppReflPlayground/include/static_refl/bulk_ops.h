@@ -0,0 +1,232 @@
+//
+// Created by qianq on 1/5/2026.
+//
+// Bulk reductions and fills over one reflected field of many objects, keyed by the
+// TypeData<T>::variables index. The field is read in place with a stride of sizeof(T), so
+// this works directly on std::vector<T>; soa_vector columns are the stride == sizeof(field) case.
+//
+// double, float, int32_t and int64_t fields use AVX2 kernels (gathers for strided data,
+// plain loads for contiguous data) when the CPU supports them, chosen once at runtime.
+// Every other arithmetic type, and CPUs without AVX2, use the scalar loops.
+// Sums of floating-point fields are reassociated across lanes. Min and max skip NaN values
+// (a NaN result means every value was NaN), the same on every path.
+
+#pragma once
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+#include "reflect_core.h"
+
+namespace my_reflect::static_refl::utils {
+
+    enum class simd_level : uint8_t {
+        Scalar,
+        AVX2
+    };
+
+    // Best level supported by this CPU and build
+    simd_level detected_simd_level();
+
+    // Level used by the bulk kernels; starts at detected_simd_level()
+    simd_level active_simd_level();
+
+    // Lowers (or restores) the level used by the kernels, clamped to what the CPU supports.
+    // Meant for tests and benchmarks; not synchronized with concurrent bulk calls.
+    void set_simd_level(simd_level level);
+
+    // Signed integers sum into int64_t, unsigned into uint64_t, floating point into itself
+    template <typename V>
+    using bulk_sum_t = std::conditional_t<std::is_floating_point_v<V>, V,
+                       std::conditional_t<std::is_signed_v<V>, int64_t, uint64_t>>;
+
+    namespace detail {
+        // Dispatched kernels, defined in bulk_ops.cpp. stride is in bytes, count > 0 for min/max.
+        double bulk_sum_f64(const std::byte* first, size_t count, size_t stride);
+        float bulk_sum_f32(const std::byte* first, size_t count, size_t stride);
+        int64_t bulk_sum_i32(const std::byte* first, size_t count, size_t stride);
+        int64_t bulk_sum_i64(const std::byte* first, size_t count, size_t stride);
+
+        double bulk_min_f64(const std::byte* first, size_t count, size_t stride);
+        float bulk_min_f32(const std::byte* first, size_t count, size_t stride);
+        int32_t bulk_min_i32(const std::byte* first, size_t count, size_t stride);
+        int64_t bulk_min_i64(const std::byte* first, size_t count, size_t stride);
+
+        double bulk_max_f64(const std::byte* first, size_t count, size_t stride);
+        float bulk_max_f32(const std::byte* first, size_t count, size_t stride);
+        int32_t bulk_max_i32(const std::byte* first, size_t count, size_t stride);
+        int64_t bulk_max_i64(const std::byte* first, size_t count, size_t stride);
+
+        template <typename V>
+        const V& strided_at(const V* first, size_t i, size_t stride) {
+            return *reinterpret_cast<const V*>(reinterpret_cast<const std::byte*>(first) + i * stride);
+        }
+
+        // Index of the first value that is not NaN, or count if there is none
+        template <typename V>
+        size_t first_ordered(const V* first, size_t count, size_t stride) {
+            size_t i = 0;
+            if constexpr (std::is_floating_point_v<V>) {
+                while (i < count && std::isnan(strided_at(first, i, stride))) {
+                    ++i;
+                }
+            }
+            return i;
+        }
+
+        // Member pointer of TypeData<T>::variables[I], checked to be a usable arithmetic member
+        template <typename T, size_t I>
+        constexpr auto bulk_member() {
+            const auto& field = std::get<I>(TypeData<T>::variables);
+            static_assert(std::decay_t<decltype(field)>::is_member(), "bulk ops need a member variable");
+            using V = std::remove_cv_t<variable_traits_t<decltype(field.ptr_)>>;
+            static_assert(std::is_arithmetic_v<V> && !std::is_same_v<V, bool>,
+                          "bulk ops need an arithmetic (non-bool) field");
+            return field.ptr_;
+        }
+
+        template <typename T, size_t I>
+        using bulk_value_t = std::remove_cv_t<variable_traits_t<decltype(bulk_member<T, I>())>>;
+    }
+
+    // ===== Strided primitives: count values starting at first, stride bytes apart =====
+
+    template <typename V>
+    bulk_sum_t<V> strided_sum(const V* first, size_t count, size_t stride = sizeof(V)) {
+        if (count == 0) {
+            return bulk_sum_t<V>{};
+        }
+        const auto* bytes = reinterpret_cast<const std::byte*>(first);
+        if constexpr (std::is_same_v<V, double>) {
+            return detail::bulk_sum_f64(bytes, count, stride);
+        } else if constexpr (std::is_same_v<V, float>) {
+            return detail::bulk_sum_f32(bytes, count, stride);
+        } else if constexpr (std::is_same_v<V, int32_t>) {
+            return detail::bulk_sum_i32(bytes, count, stride);
+        } else if constexpr (std::is_same_v<V, int64_t>) {
+            return detail::bulk_sum_i64(bytes, count, stride);
+        } else {
+            bulk_sum_t<V> total{};
+            for (size_t i = 0; i < count; ++i) {
+                total += detail::strided_at(first, i, stride);
+            }
+            return total;
+        }
+    }
+
+    template <typename V>
+    V strided_min(const V* first, size_t count, size_t stride = sizeof(V)) {
+        if (count == 0) {
+            throw std::runtime_error("bulk min: empty range");
+        }
+        const auto* bytes = reinterpret_cast<const std::byte*>(first);
+        if constexpr (std::is_same_v<V, double>) {
+            return detail::bulk_min_f64(bytes, count, stride);
+        } else if constexpr (std::is_same_v<V, float>) {
+            return detail::bulk_min_f32(bytes, count, stride);
+        } else if constexpr (std::is_same_v<V, int32_t>) {
+            return detail::bulk_min_i32(bytes, count, stride);
+        } else if constexpr (std::is_same_v<V, int64_t>) {
+            return detail::bulk_min_i64(bytes, count, stride);
+        } else {
+            size_t start = detail::first_ordered(first, count, stride);
+            if (start == count) {
+                return *first;
+            }
+            V result = detail::strided_at(first, start, stride);
+            for (size_t i = start + 1; i < count; ++i) {
+                const V& value = detail::strided_at(first, i, stride);
+                result = value < result ? value : result;
+            }
+            return result;
+        }
+    }
+
+    template <typename V>
+    V strided_max(const V* first, size_t count, size_t stride = sizeof(V)) {
+        if (count == 0) {
+            throw std::runtime_error("bulk max: empty range");
+        }
+        const auto* bytes = reinterpret_cast<const std::byte*>(first);
+        if constexpr (std::is_same_v<V, double>) {
+            return detail::bulk_max_f64(bytes, count, stride);
+        } else if constexpr (std::is_same_v<V, float>) {
+            return detail::bulk_max_f32(bytes, count, stride);
+        } else if constexpr (std::is_same_v<V, int32_t>) {
+            return detail::bulk_max_i32(bytes, count, stride);
+        } else if constexpr (std::is_same_v<V, int64_t>) {
+            return detail::bulk_max_i64(bytes, count, stride);
+        } else {
+            size_t start = detail::first_ordered(first, count, stride);
+            if (start == count) {
+                return *first;
+            }
+            V result = detail::strided_at(first, start, stride);
+            for (size_t i = start + 1; i < count; ++i) {
+                const V& value = detail::strided_at(first, i, stride);
+                result = result < value ? value : result;
+            }
+            return result;
+        }
+    }
+
+    // AVX2 has no scatter, so fills are plain stores (contiguous ones vectorize on their own)
+    template <typename V>
+    void strided_fill(V* first, size_t count, size_t stride, V value) {
+        auto* bytes = reinterpret_cast<std::byte*>(first);
+        for (size_t i = 0; i < count; ++i) {
+            *reinterpret_cast<V*>(bytes + i * stride) = value;
+        }
+    }
+
+    // ===== Field-keyed API: I is the TypeData<T>::variables index =====
+
+    template <size_t I, typename T>
+    auto bulk_sum(const T* objects, size_t count) {
+        constexpr auto ptr = detail::bulk_member<T, I>();
+        return strided_sum(count ? &(objects->*ptr) : nullptr, count, sizeof(T));
+    }
+
+    template <size_t I, typename T>
+    auto bulk_sum(const std::vector<T>& objects) {
+        return bulk_sum<I>(objects.data(), objects.size());
+    }
+
+    template <size_t I, typename T>
+    auto bulk_min(const T* objects, size_t count) {
+        constexpr auto ptr = detail::bulk_member<T, I>();
+        return strided_min(count ? &(objects->*ptr) : nullptr, count, sizeof(T));
+    }
+
+    template <size_t I, typename T>
+    auto bulk_min(const std::vector<T>& objects) {
+        return bulk_min<I>(objects.data(), objects.size());
+    }
+
+    template <size_t I, typename T>
+    auto bulk_max(const T* objects, size_t count) {
+        constexpr auto ptr = detail::bulk_member<T, I>();
+        return strided_max(count ? &(objects->*ptr) : nullptr, count, sizeof(T));
+    }
+
+    template <size_t I, typename T>
+    auto bulk_max(const std::vector<T>& objects) {
+        return bulk_max<I>(objects.data(), objects.size());
+    }
+
+    template <size_t I, typename T>
+    void bulk_fill(T* objects, size_t count, const detail::bulk_value_t<T, I>& value) {
+        constexpr auto ptr = detail::bulk_member<T, I>();
+        if (count) {
+            strided_fill(&(objects->*ptr), count, sizeof(T), value);
+        }
+    }
+
+    template <size_t I, typename T>
+    void bulk_fill(std::vector<T>& objects, const detail::bulk_value_t<T, I>& value) {
+        bulk_fill<I>(objects.data(), objects.size(), value);
+    }
+}
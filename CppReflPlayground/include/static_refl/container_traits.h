@@ -3,12 +3,18 @@
 //
 
 #pragma once
+#include <array>
+#include <cstddef>
+#include <deque>
 #include <map>
 #include <set>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 namespace my_reflect::static_refl {
+    // std::span is C++20; this library targets C++17, so it has no Span kind
     enum class ContainerKind {
-        Set, Vector, Map
+        Set, Vector, Map, UnorderedSet, UnorderedMap, Deque, Array
     };
 
     namespace detail {
@@ -42,6 +48,39 @@ namespace my_reflect::static_refl {
             using value_type = V;
         };
 
+        template <typename T, typename H, typename E, typename A>
+        struct container_traits<std::unordered_set<T, H, E, A>> {
+            static constexpr auto kind = ContainerKind::UnorderedSet;
+            static constexpr bool is_container = true;
+            static constexpr bool is_member = false;
+            using value_type = T;
+        };
+
+        template <typename K, typename V, typename H, typename E, typename A>
+        struct container_traits<std::unordered_map<K, V, H, E, A>> {
+            static constexpr auto kind = ContainerKind::UnorderedMap;
+            static constexpr bool is_container = true;
+            static constexpr bool is_member = false;
+            using key_type = K;
+            using value_type = V;
+        };
+
+        template <typename T, typename A>
+        struct container_traits<std::deque<T, A>> {
+            static constexpr auto kind = ContainerKind::Deque;
+            static constexpr bool is_container = true;
+            static constexpr bool is_member = false;
+            using value_type = T;
+        };
+
+        template <typename T, size_t N>
+        struct container_traits<std::array<T, N>> {
+            static constexpr auto kind = ContainerKind::Array;
+            static constexpr bool is_container = true;
+            static constexpr bool is_member = false;
+            using value_type = T;
+        };
+
         // ===== Member pointer specializations =====
 
         // std::vector<T> Class::*
@@ -74,6 +113,47 @@ namespace my_reflect::static_refl {
             using class_type = ClassT;
             static constexpr bool is_member = true;
         };
+
+        // std::unordered_set<T> Class::*
+        template <typename ClassT, typename T, typename H, typename E, typename A>
+        struct container_traits<std::unordered_set<T, H, E, A> ClassT::*> {
+            static constexpr auto kind = ContainerKind::UnorderedSet;
+            static constexpr bool is_container = true;
+            using value_type = T;
+            using class_type = ClassT;
+            static constexpr bool is_member = true;
+        };
+
+        // std::unordered_map<K, V> Class::*
+        template <typename ClassT, typename K, typename V, typename H, typename E, typename A>
+        struct container_traits<std::unordered_map<K, V, H, E, A> ClassT::*> {
+            static constexpr auto kind = ContainerKind::UnorderedMap;
+            static constexpr bool is_container = true;
+            using key_type = K;
+            using value_type = V;
+            using class_type = ClassT;
+            static constexpr bool is_member = true;
+        };
+
+        // std::deque<T> Class::*
+        template <typename ClassT, typename T, typename A>
+        struct container_traits<std::deque<T, A> ClassT::*> {
+            static constexpr auto kind = ContainerKind::Deque;
+            static constexpr bool is_container = true;
+            using value_type = T;
+            using class_type = ClassT;
+            static constexpr bool is_member = true;
+        };
+
+        // std::array<T, N> Class::*
+        template <typename ClassT, typename T, size_t N>
+        struct container_traits<std::array<T, N> ClassT::*> {
+            static constexpr auto kind = ContainerKind::Array;
+            static constexpr bool is_container = true;
+            using value_type = T;
+            using class_type = ClassT;
+            static constexpr bool is_member = true;
+        };
     }
 
     template <typename T>
@@ -88,6 +168,19 @@ namespace my_reflect::static_refl {
     template <typename T>
     constexpr bool is_container_v = detail::container_traits<T>::is_container;
 
+    // Kinds that share an interface: keyed lookup, unique elements, elements in one block
+    constexpr bool is_map_kind(ContainerKind kind) {
+        return kind == ContainerKind::Map || kind == ContainerKind::UnorderedMap;
+    }
+
+    constexpr bool is_set_kind(ContainerKind kind) {
+        return kind == ContainerKind::Set || kind == ContainerKind::UnorderedSet;
+    }
+
+    constexpr bool is_contiguous_kind(ContainerKind kind) {
+        return kind == ContainerKind::Vector || kind == ContainerKind::Array;
+    }
+
 
 }
 
@@ -0,0 +1,718 @@
+//
+// Created by qianq on 1/5/2026.
+//
+// JSON reader/writer generated from TypeData<T>.
+//
+// Mapping:
+//   reflected class     -> object; base class fields first, then variables, then containers
+//   bool / arithmetic   -> true/false / number (non-finite floating point values become null)
+//   enum                -> name registered through dynamic_refl::Register<E>().Add(...), else number
+//   std::string         -> string
+//   vector/deque/array/set/unordered_set -> array
+//   std::map/unordered_map<string, V> -> object; other maps -> array of [key, value] pairs
+//
+// Writing appends compact JSON to a reusable JsonWriter. Reading is one pass over a
+// string_view: tokens are views into the input and strings are only unescaped when they
+// contain escapes. Object keys are matched against compile-time FNV-1a hashes of the field names.
+
+#pragma once
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "reflect_core.h"
+#include "binary_serializer.h"
+#include "../dynamic_refl/Enum.h"
+#include "name_hash.h"
+
+namespace my_reflect::static_refl::utils {
+
+    // Append-only JSON output buffer. Reuse one writer across documents to keep its capacity.
+    class JsonWriter {
+    public:
+        void put(char c) { buffer_.push_back(c); }
+        void raw(std::string_view text) { buffer_.append(text.data(), text.size()); }
+
+        void string(std::string_view text) {
+            static constexpr char hex[] = "0123456789abcdef";
+            put('"');
+            size_t runStart = 0;
+            for (size_t i = 0; i < text.size(); ++i) {
+                unsigned char c = static_cast<unsigned char>(text[i]);
+                if (c >= 0x20 && c != '"' && c != '\\') {
+                    continue;
+                }
+                // Copy the clean run in one go, then the escape
+                raw(text.substr(runStart, i - runStart));
+                runStart = i + 1;
+                switch (c) {
+                    case '"': raw("\\\""); break;
+                    case '\\': raw("\\\\"); break;
+                    case '\n': raw("\\n"); break;
+                    case '\r': raw("\\r"); break;
+                    case '\t': raw("\\t"); break;
+                    case '\b': raw("\\b"); break;
+                    case '\f': raw("\\f"); break;
+                    default: {
+                        char escape[] = {'\\', 'u', '0', '0', hex[c >> 4], hex[c & 0xF]};
+                        raw(std::string_view(escape, sizeof(escape)));
+                    }
+                }
+            }
+            raw(text.substr(runStart));
+            put('"');
+        }
+
+        template <typename T>
+        void number(T value) {
+            static_assert(std::is_arithmetic_v<T>, "number() expects an arithmetic value");
+            if constexpr (std::is_floating_point_v<T>) {
+                if (!std::isfinite(value)) {
+                    raw("null");
+                    return;
+                }
+            }
+            char digits[64];
+            auto result = std::to_chars(digits, digits + sizeof(digits), value);
+            raw(std::string_view(digits, result.ptr - digits));
+        }
+
+        void clear() { buffer_.clear(); }
+        size_t size() const { return buffer_.size(); }
+        const std::string& str() const { return buffer_; }
+        std::string release() { return std::move(buffer_); }
+
+    private:
+        std::string buffer_;
+    };
+
+    // Single-pass JSON tokenizer over a string_view. Throws std::runtime_error on malformed input.
+    class JsonReader {
+    public:
+        enum class TokenKind {
+            ObjectBegin, ObjectEnd, ArrayBegin, ArrayEnd, Colon, Comma,
+            String, Number, True, False, Null, End
+        };
+
+        struct Token {
+            TokenKind kind = TokenKind::End;
+            std::string_view text;   // string contents without quotes, or the number literal
+            bool escaped = false;    // string contains escape sequences
+        };
+
+        explicit JsonReader(std::string_view input) : input_(input) {}
+
+        const Token& peek() {
+            if (!hasPeeked_) {
+                peeked_ = scan();
+                hasPeeked_ = true;
+            }
+            return peeked_;
+        }
+
+        Token next() {
+            peek();
+            hasPeeked_ = false;
+            return peeked_;
+        }
+
+        Token expect(TokenKind kind, const char* what) {
+            Token token = next();
+            if (token.kind != kind) {
+                fail(std::string("expected ") + what);
+            }
+            return token;
+        }
+
+        // Consumes the next token if it has the given kind
+        bool accept(TokenKind kind) {
+            if (peek().kind == kind) {
+                hasPeeked_ = false;
+                return true;
+            }
+            return false;
+        }
+
+        // Skips one complete value (used for unknown object keys)
+        void skip_value() {
+            Token token = next();
+            if (token.kind == TokenKind::ObjectBegin || token.kind == TokenKind::ArrayBegin) {
+                size_t depth = 1;
+                while (depth > 0) {
+                    token = next();
+                    if (token.kind == TokenKind::ObjectBegin || token.kind == TokenKind::ArrayBegin) {
+                        ++depth;
+                    } else if (token.kind == TokenKind::ObjectEnd || token.kind == TokenKind::ArrayEnd) {
+                        --depth;
+                    } else if (token.kind == TokenKind::End) {
+                        fail("unexpected end of input");
+                    }
+                }
+            } else if (token.kind != TokenKind::String && token.kind != TokenKind::Number &&
+                       token.kind != TokenKind::True && token.kind != TokenKind::False &&
+                       token.kind != TokenKind::Null) {
+                fail("expected a value");
+            }
+        }
+
+        // Decodes a string token into out, unescaping only when needed
+        void decode_string(const Token& token, std::string& out) const {
+            if (!token.escaped) {
+                out.assign(token.text.data(), token.text.size());
+                return;
+            }
+            out.clear();
+            out.reserve(token.text.size());
+            for (size_t i = 0; i < token.text.size(); ++i) {
+                char c = token.text[i];
+                if (c != '\\') {
+                    out.push_back(c);
+                    continue;
+                }
+                char e = token.text[++i];
+                switch (e) {
+                    case '"': out.push_back('"'); break;
+                    case '\\': out.push_back('\\'); break;
+                    case '/': out.push_back('/'); break;
+                    case 'b': out.push_back('\b'); break;
+                    case 'f': out.push_back('\f'); break;
+                    case 'n': out.push_back('\n'); break;
+                    case 'r': out.push_back('\r'); break;
+                    case 't': out.push_back('\t'); break;
+                    case 'u': {
+                        uint32_t code = parse_hex4(token.text, i + 1);
+                        i += 4;
+                        // Combine a UTF-16 surrogate pair
+                        if (code >= 0xD800 && code <= 0xDBFF && i + 6 < token.text.size() &&
+                            token.text[i + 1] == '\\' && token.text[i + 2] == 'u') {
+                            uint32_t low = parse_hex4(token.text, i + 3);
+                            if (low >= 0xDC00 && low <= 0xDFFF) {
+                                code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                                i += 6;
+                            }
+                        }
+                        append_utf8(out, code);
+                        break;
+                    }
+                    default: fail("invalid escape sequence");
+                }
+            }
+        }
+
+        [[noreturn]] void fail(const std::string& message) const {
+            throw std::runtime_error("JSON parse error at offset " + std::to_string(pos_) + ": " + message);
+        }
+
+    private:
+        std::string_view input_;
+        size_t pos_ = 0;
+        Token peeked_;
+        bool hasPeeked_ = false;
+
+        // Spells out every member, so -Wmissing-field-initializers stays quiet
+        static Token make_token(TokenKind kind, std::string_view text = {}, bool escaped = false) {
+            Token token;
+            token.kind = kind;
+            token.text = text;
+            token.escaped = escaped;
+            return token;
+        }
+
+        Token scan() {
+            while (pos_ < input_.size() && (input_[pos_] == ' ' || input_[pos_] == '\t' ||
+                                            input_[pos_] == '\n' || input_[pos_] == '\r')) {
+                ++pos_;
+            }
+            if (pos_ == input_.size()) {
+                return make_token(TokenKind::End);
+            }
+
+            char c = input_[pos_];
+            switch (c) {
+                case '{': ++pos_; return make_token(TokenKind::ObjectBegin);
+                case '}': ++pos_; return make_token(TokenKind::ObjectEnd);
+                case '[': ++pos_; return make_token(TokenKind::ArrayBegin);
+                case ']': ++pos_; return make_token(TokenKind::ArrayEnd);
+                case ':': ++pos_; return make_token(TokenKind::Colon);
+                case ',': ++pos_; return make_token(TokenKind::Comma);
+                case '"': return scan_string();
+                case 't': return scan_literal("true", TokenKind::True);
+                case 'f': return scan_literal("false", TokenKind::False);
+                case 'n': return scan_literal("null", TokenKind::Null);
+                default:
+                    if (c == '-' || (c >= '0' && c <= '9')) {
+                        return scan_number();
+                    }
+                    fail(std::string("unexpected character '") + c + "'");
+            }
+        }
+
+        Token scan_string() {
+            size_t start = ++pos_;
+            bool escaped = false;
+            while (pos_ < input_.size()) {
+                char c = input_[pos_];
+                if (c == '"') {
+                    Token token = make_token(TokenKind::String, input_.substr(start, pos_ - start), escaped);
+                    ++pos_;
+                    return token;
+                }
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    // The writer escapes these; raw ones are not valid JSON
+                    fail("unescaped control character in string");
+                }
+                if (c == '\\') {
+                    escaped = true;
+                    ++pos_;
+                }
+                ++pos_;
+            }
+            fail("unterminated string");
+        }
+
+        Token scan_number() {
+            size_t start = pos_;
+            while (pos_ < input_.size()) {
+                char c = input_[pos_];
+                if ((c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E') {
+                    ++pos_;
+                } else {
+                    break;
+                }
+            }
+            return make_token(TokenKind::Number, input_.substr(start, pos_ - start));
+        }
+
+        Token scan_literal(std::string_view literal, TokenKind kind) {
+            if (input_.substr(pos_, literal.size()) != literal) {
+                fail("invalid literal");
+            }
+            pos_ += literal.size();
+            return make_token(kind);
+        }
+
+        uint32_t parse_hex4(std::string_view text, size_t at) const {
+            if (at + 4 > text.size()) {
+                fail("truncated \\u escape");
+            }
+            uint32_t code = 0;
+            auto result = std::from_chars(text.data() + at, text.data() + at + 4, code, 16);
+            if (result.ptr != text.data() + at + 4) {
+                fail("invalid \\u escape");
+            }
+            return code;
+        }
+
+        static void append_utf8(std::string& out, uint32_t code) {
+            if (code < 0x80) {
+                out.push_back(static_cast<char>(code));
+            } else if (code < 0x800) {
+                out.push_back(static_cast<char>(0xC0 | (code >> 6)));
+                out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+            } else if (code < 0x10000) {
+                out.push_back(static_cast<char>(0xE0 | (code >> 12)));
+                out.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+                out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+            } else {
+                out.push_back(static_cast<char>(0xF0 | (code >> 18)));
+                out.push_back(static_cast<char>(0x80 | ((code >> 12) & 0x3F)));
+                out.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+                out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+            }
+        }
+    };
+
+    namespace detail {
+        // Compile-time hash of the I-th field name of a TypeData field tuple
+        template <const auto& Fields, size_t I>
+        inline constexpr uint64_t field_hash_v = hash_name(std::get<I>(Fields).name_);
+
+        template <const auto& Fields, size_t... I>
+        constexpr bool field_hashes_unique(std::index_sequence<I...>) {
+            constexpr uint64_t hashes[] = {field_hash_v<Fields, I>..., 0};
+            for (size_t a = 0; a < sizeof...(I); ++a) {
+                for (size_t b = a + 1; b < sizeof...(I); ++b) {
+                    if (hashes[a] == hashes[b]) {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+        template <typename T>
+        void write_json(JsonWriter& out, const T& value);
+
+        template <typename T>
+        void read_json(JsonReader& in, T& value);
+
+        template <typename E>
+        void write_enum(JsonWriter& out, E value) {
+            std::string_view name = dynamic_refl::EnumFactory<E>::Instance().GetInfo().FindName(static_cast<long long>(value));
+            if (!name.empty()) {
+                out.string(name);
+                return;
+            }
+            out.number(static_cast<std::underlying_type_t<E>>(value));
+        }
+
+        template <typename E>
+        void read_enum(JsonReader& in, E& value) {
+            JsonReader::Token token = in.next();
+            if (token.kind == JsonReader::TokenKind::Number) {
+                std::underlying_type_t<E> raw{};
+                auto result = std::from_chars(token.text.data(), token.text.data() + token.text.size(), raw);
+                if (result.ptr != token.text.data() + token.text.size()) {
+                    in.fail("invalid enum value");
+                }
+                value = static_cast<E>(raw);
+                return;
+            }
+            if (token.kind != JsonReader::TokenKind::String) {
+                in.fail("expected an enum name");
+            }
+            std::string name;
+            in.decode_string(token, name);
+            if (auto found = dynamic_refl::EnumFactory<E>::Instance().GetInfo().FindValue(name)) {
+                value = static_cast<E>(*found);
+                return;
+            }
+            in.fail("unknown enum name '" + name + "'");
+        }
+
+        template <typename T>
+        void read_number(JsonReader& in, T& value) {
+            JsonReader::Token token = in.next();
+            if constexpr (std::is_floating_point_v<T>) {
+                if (token.kind == JsonReader::TokenKind::Null) {
+                    value = std::numeric_limits<T>::quiet_NaN();
+                    return;
+                }
+            }
+            if (token.kind != JsonReader::TokenKind::Number) {
+                in.fail("expected a number");
+            }
+            const char* first = token.text.data();
+            const char* last = first + token.text.size();
+            std::from_chars_result result{};
+            if constexpr (std::is_same_v<T, char> || std::is_same_v<T, signed char> || std::is_same_v<T, unsigned char>) {
+                // Parsed as int, so the range of T is checked here rather than by from_chars
+                int wide = 0;
+                result = std::from_chars(first, last, wide);
+                if (result.ec == std::errc() && (wide < std::numeric_limits<T>::min() || wide > std::numeric_limits<T>::max())) {
+                    result.ec = std::errc::result_out_of_range;
+                }
+                value = static_cast<T>(wide);
+            } else {
+                result = std::from_chars(first, last, value);
+            }
+            if (result.ec == std::errc::result_out_of_range) {
+                in.fail("number '" + std::string(token.text) + "' is out of range");
+            }
+            if (result.ec != std::errc() || result.ptr != last) {
+                in.fail("invalid number '" + std::string(token.text) + "'");
+            }
+        }
+
+        // ----- reflected classes -----
+
+        template <typename T, typename Tuple>
+        void write_fields(JsonWriter& out, const T& obj, const Tuple& fields, bool& first) {
+            std::apply([&](const auto&... field) {
+                ([&](const auto& f) {
+                    if constexpr (std::decay_t<decltype(f)>::is_member()) {
+                        if (!first) {
+                            out.put(',');
+                        }
+                        first = false;
+                        out.put('"');
+                        out.raw(f.name_);
+                        out.raw("\":");
+                        write_json(out, obj.*(f.ptr_));
+                    }
+                }(field), ...);
+            }, fields);
+        }
+
+        template <typename T>
+        void write_object_fields(JsonWriter& out, const T& obj, bool& first);
+
+        template <typename T, typename... Bases>
+        void write_bases(JsonWriter& out, const T& obj, bool& first, type_list<Bases...>) {
+            (write_object_fields(out, static_cast<const Bases&>(obj), first), ...);
+        }
+
+        template <typename T>
+        void write_object_fields(JsonWriter& out, const T& obj, bool& first) {
+            write_bases(out, obj, first, typename base_types_of<T>::type{});
+            if constexpr (has_variables<T>::value) {
+                write_fields(out, obj, TypeData<T>::variables, first);
+            }
+            if constexpr (has_containers<T>::value) {
+                write_fields(out, obj, TypeData<T>::containers, first);
+            }
+        }
+
+        // An object key: the decoded name and its hash
+        struct JsonKey {
+            std::string_view name;
+            uint64_t hash = 0;
+        };
+
+        // Reads the value of the field named key; false if T has no such field. The hash
+        // rules out other fields cheaply, the name check rejects keys that merely collide.
+        template <const auto& Fields, typename T, size_t... I>
+        bool read_field(JsonReader& in, T& obj, [[maybe_unused]] const JsonKey& key, std::index_sequence<I...> seq) {
+            static_assert(field_hashes_unique<Fields>(seq), "Field names of a reflected type must hash uniquely");
+            bool matched = false;
+            ([&] {
+                if constexpr (std::decay_t<decltype(std::get<I>(Fields))>::is_member()) {
+                    if (!matched && key.hash == field_hash_v<Fields, I> && std::get<I>(Fields).name_ == key.name) {
+                        read_json(in, obj.*(std::get<I>(Fields).ptr_));
+                        matched = true;
+                    }
+                }
+            }(), ...);
+            return matched;
+        }
+
+        template <typename T>
+        bool read_object_field(JsonReader& in, T& obj, const JsonKey& key);
+
+        template <typename T, typename... Bases>
+        bool read_base_field(JsonReader& in, T& obj, [[maybe_unused]] const JsonKey& key, type_list<Bases...>) {
+            return (read_object_field(in, static_cast<Bases&>(obj), key) || ...);
+        }
+
+        template <typename T>
+        bool read_object_field(JsonReader& in, T& obj, const JsonKey& key) {
+            if constexpr (has_variables<T>::value) {
+                constexpr size_t count = std::tuple_size_v<std::remove_cv_t<decltype(TypeData<T>::variables)>>;
+                if (read_field<TypeData<T>::variables>(in, obj, key, std::make_index_sequence<count>{})) {
+                    return true;
+                }
+            }
+            if constexpr (has_containers<T>::value) {
+                constexpr size_t count = std::tuple_size_v<std::remove_cv_t<decltype(TypeData<T>::containers)>>;
+                if (read_field<TypeData<T>::containers>(in, obj, key, std::make_index_sequence<count>{})) {
+                    return true;
+                }
+            }
+            return read_base_field(in, obj, key, typename base_types_of<T>::type{});
+        }
+
+        // The returned name points into the input, or into scratch when the key has escapes
+        inline JsonKey read_key(JsonReader& in, std::string& scratch) {
+            JsonReader::Token token = in.expect(JsonReader::TokenKind::String, "an object key");
+            in.expect(JsonReader::TokenKind::Colon, "':'");
+            std::string_view name = token.text;
+            if (token.escaped) {
+                in.decode_string(token, scratch);
+                name = scratch;
+            }
+            return JsonKey{name, hash_name(name)};
+        }
+
+        // ----- dispatch -----
+
+        template <typename T>
+        void write_json(JsonWriter& out, const T& value) {
+            if constexpr (is_reflected_v<T>) {
+                bool first = true;
+                out.put('{');
+                write_object_fields(out, value, first);
+                out.put('}');
+            } else if constexpr (std::is_same_v<T, bool>) {
+                out.raw(value ? "true" : "false");
+            } else if constexpr (std::is_arithmetic_v<T>) {
+                if constexpr (std::is_same_v<T, char> || std::is_same_v<T, signed char> || std::is_same_v<T, unsigned char>) {
+                    out.number(static_cast<int>(value));
+                } else {
+                    out.number(value);
+                }
+            } else if constexpr (std::is_enum_v<T>) {
+                write_enum(out, value);
+            } else if constexpr (std::is_same_v<T, std::string>) {
+                out.string(value);
+            } else if constexpr (is_container_kind<T>(is_map_kind)) {
+                if constexpr (std::is_same_v<typename T::key_type, std::string>) {
+                    out.put('{');
+                    bool first = true;
+                    for (const auto& [key, mapped] : value) {
+                        if (!first) {
+                            out.put(',');
+                        }
+                        first = false;
+                        out.string(key);
+                        out.put(':');
+                        write_json(out, mapped);
+                    }
+                    out.put('}');
+                } else {
+                    out.put('[');
+                    bool first = true;
+                    for (const auto& [key, mapped] : value) {
+                        if (!first) {
+                            out.put(',');
+                        }
+                        first = false;
+                        out.put('[');
+                        write_json(out, key);
+                        out.put(',');
+                        write_json(out, mapped);
+                        out.put(']');
+                    }
+                    out.put(']');
+                }
+            } else if constexpr (is_container_kind<T>(ContainerKind::Vector) || is_container_kind<T>(ContainerKind::Deque)
+                                 || is_container_kind<T>(ContainerKind::Array) || is_container_kind<T>(is_set_kind)) {
+                using Elem = typename T::value_type;
+                out.put('[');
+                bool first = true;
+                for (const auto& elem : value) {
+                    if (!first) {
+                        out.put(',');
+                    }
+                    first = false;
+                    write_json(out, static_cast<const Elem&>(elem));
+                }
+                out.put(']');
+            } else {
+                static_assert(dependent_false_v<T>, "Type is not JSON serializable");
+            }
+        }
+
+        template <typename T>
+        void read_json(JsonReader& in, T& value) {
+            using TokenKind = JsonReader::TokenKind;
+            if constexpr (is_reflected_v<T>) {
+                in.expect(TokenKind::ObjectBegin, "'{'");
+                if (in.accept(TokenKind::ObjectEnd)) {
+                    return;
+                }
+                std::string scratch;
+                do {
+                    JsonKey key = read_key(in, scratch);
+                    if (!read_object_field(in, value, key)) {
+                        in.skip_value();
+                    }
+                } while (in.accept(TokenKind::Comma));
+                in.expect(TokenKind::ObjectEnd, "'}'");
+            } else if constexpr (std::is_same_v<T, bool>) {
+                JsonReader::Token token = in.next();
+                if (token.kind != TokenKind::True && token.kind != TokenKind::False) {
+                    in.fail("expected true or false");
+                }
+                value = token.kind == TokenKind::True;
+            } else if constexpr (std::is_arithmetic_v<T>) {
+                read_number(in, value);
+            } else if constexpr (std::is_enum_v<T>) {
+                read_enum(in, value);
+            } else if constexpr (std::is_same_v<T, std::string>) {
+                in.decode_string(in.expect(TokenKind::String, "a string"), value);
+            } else if constexpr (is_container_kind<T>(is_map_kind)) {
+                using Key = typename T::key_type;
+                using Mapped = typename T::mapped_type;
+                value.clear();
+                if constexpr (std::is_same_v<Key, std::string>) {
+                    in.expect(TokenKind::ObjectBegin, "'{'");
+                    if (in.accept(TokenKind::ObjectEnd)) {
+                        return;
+                    }
+                    do {
+                        Key key;
+                        in.decode_string(in.expect(TokenKind::String, "an object key"), key);
+                        in.expect(TokenKind::Colon, "':'");
+                        Mapped mapped{};
+                        read_json(in, mapped);
+                        value.insert_or_assign(std::move(key), std::move(mapped));
+                    } while (in.accept(TokenKind::Comma));
+                    in.expect(TokenKind::ObjectEnd, "'}'");
+                } else {
+                    in.expect(TokenKind::ArrayBegin, "'['");
+                    if (in.accept(TokenKind::ArrayEnd)) {
+                        return;
+                    }
+                    do {
+                        in.expect(TokenKind::ArrayBegin, "'['");
+                        Key key{};
+                        read_json(in, key);
+                        in.expect(TokenKind::Comma, "','");
+                        Mapped mapped{};
+                        read_json(in, mapped);
+                        in.expect(TokenKind::ArrayEnd, "']'");
+                        value.insert_or_assign(std::move(key), std::move(mapped));
+                    } while (in.accept(TokenKind::Comma));
+                    in.expect(TokenKind::ArrayEnd, "']'");
+                }
+            } else if constexpr (is_container_kind<T>(ContainerKind::Array)) {
+                in.expect(TokenKind::ArrayBegin, "'['");
+                size_t count = 0;
+                if (!in.accept(TokenKind::ArrayEnd)) {
+                    do {
+                        if (count == value.size()) {
+                            in.fail("too many elements for a fixed-size array");
+                        }
+                        read_json(in, value[count++]);
+                    } while (in.accept(TokenKind::Comma));
+                    in.expect(TokenKind::ArrayEnd, "']'");
+                }
+                if (count != value.size()) {
+                    in.fail("too few elements for a fixed-size array");
+                }
+            } else if constexpr (is_container_kind<T>(ContainerKind::Vector) || is_container_kind<T>(ContainerKind::Deque)
+                                 || is_container_kind<T>(is_set_kind)) {
+                using Elem = typename T::value_type;
+                value.clear();
+                in.expect(TokenKind::ArrayBegin, "'['");
+                if (in.accept(TokenKind::ArrayEnd)) {
+                    return;
+                }
+                do {
+                    Elem elem{};
+                    read_json(in, elem);
+                    value.insert(value.end(), std::move(elem));
+                } while (in.accept(TokenKind::Comma));
+                in.expect(TokenKind::ArrayEnd, "']'");
+            } else {
+                static_assert(dependent_false_v<T>, "Type is not JSON serializable");
+            }
+        }
+    }
+
+    // Appends the JSON encoding of obj to out
+    template <typename T>
+    void to_json(const T& obj, JsonWriter& out) {
+        detail::write_json(out, obj);
+    }
+
+    template <typename T>
+    std::string to_json(const T& obj) {
+        JsonWriter out;
+        detail::write_json(out, obj);
+        return out.release();
+    }
+
+    // Reads the next JSON value from in into obj. Unknown object keys are skipped,
+    // fields missing from the input keep their current value.
+    template <typename T>
+    void from_json(T& obj, JsonReader& in) {
+        detail::read_json(in, obj);
+    }
+
+    // Reads a whole JSON document into obj; trailing characters are an error
+    template <typename T>
+    void from_json(T& obj, std::string_view json) {
+        JsonReader in(json);
+        detail::read_json(in, obj);
+        if (in.peek().kind != JsonReader::TokenKind::End) {
+            in.fail("trailing characters after value");
+        }
+    }
+}
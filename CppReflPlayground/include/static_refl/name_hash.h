@@ -0,0 +1,194 @@
+//
+// Created by qianq on 1/5/2026.
+//
+// Compile-time minimal perfect hash over a fixed set of names, used by the
+// BEGIN_REFLECT macros to map a (runtime or compile-time) name to a field index
+// with one hash, one table probe and one string compare.
+
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <utility>
+
+namespace my_reflect::static_refl {
+
+    // 64-bit FNV-1a hash, usable at compile time. Shared by the static tables and the dynamic
+    // registries (dynamic_refl::utils::HashName forwards here), so both agree on every name.
+    constexpr uint64_t hash_name(std::string_view name) {
+        uint64_t hash = 14695981039346656037ull;
+        for (char c : name) {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    /**
+     * @brief Minimal perfect hash table from N names to their positions.
+     *
+     * Built with hash-and-displace: names are grouped into N buckets by hash, and each
+     * bucket (largest first) gets a displacement seed that sends all of its names to
+     * distinct free slots. Single-name buckets store their slot directly. The table has
+     * exactly N slots.
+     *
+     * Duplicate names keep the first position, matching a left-to-right linear search.
+     * If some bucket finds no seed within max_seed tries, build() throws std::logic_error,
+     * which is a compile error when the table is built in a constant expression.
+     *
+     * Usage:
+     * @code
+     * constexpr auto table = name_hash_table<3>::build({"age", "name", "id"});
+     * static_assert(table.find("name") == 1);
+     * static_assert(table.find("salary") == -1);
+     * @endcode
+     */
+    template <size_t N>
+    struct name_hash_table {
+        std::array<std::string_view, N> names{};  // name stored in each slot
+        std::array<int, N> indices{};             // original position of each slot's name, -1 if empty
+        std::array<int64_t, N> displacement{};    // per bucket: seed (> 0), direct slot -(slot + 1), or 0 if empty
+
+        // Seeds tried per bucket before build() gives up; real field lists need a handful
+        static constexpr int64_t max_seed = 1 << 16;
+
+        static constexpr uint64_t mix(uint64_t hash, int64_t seed) {
+            uint64_t x = hash + static_cast<uint64_t>(seed) * 0x9E3779B97F4A7C15ull;
+            x ^= x >> 33;
+            x *= 0xff51afd7ed558ccdull;
+            x ^= x >> 33;
+            return x;
+        }
+
+        constexpr int find(std::string_view name) const {
+            if constexpr (N == 0) {
+                return -1;
+            } else {
+                uint64_t hash = hash_name(name);
+                int64_t d = displacement[hash % N];
+                size_t slot = d < 0 ? static_cast<size_t>(-d - 1) : static_cast<size_t>(mix(hash, d) % N);
+                return names[slot] == name ? indices[slot] : -1;
+            }
+        }
+
+        static constexpr name_hash_table build(const std::array<std::string_view, N>& keys) {
+            name_hash_table table{};
+            for (size_t i = 0; i < N; ++i) {
+                table.indices[i] = -1;
+            }
+
+            if constexpr (N > 0) {
+                std::array<uint64_t, N> hashes{};
+                std::array<bool, N> unique{};
+                std::array<size_t, N> bucketSize{};
+                for (size_t i = 0; i < N; ++i) {
+                    hashes[i] = hash_name(keys[i]);
+                    unique[i] = true;
+                    for (size_t j = 0; j < i; ++j) {
+                        if (keys[j] == keys[i]) {
+                            unique[i] = false;
+                            break;
+                        }
+                    }
+                    if (unique[i]) {
+                        ++bucketSize[hashes[i] % N];
+                    }
+                }
+
+                // Buckets by decreasing size: crowded buckets are placed while most slots are free
+                std::array<size_t, N> order{};
+                for (size_t i = 0; i < N; ++i) {
+                    order[i] = i;
+                }
+                for (size_t i = 0; i < N; ++i) {
+                    size_t largest = i;
+                    for (size_t j = i + 1; j < N; ++j) {
+                        if (bucketSize[order[j]] > bucketSize[order[largest]]) {
+                            largest = j;
+                        }
+                    }
+                    size_t tmp = order[i];
+                    order[i] = order[largest];
+                    order[largest] = tmp;
+                }
+
+                std::array<bool, N> used{};
+                for (size_t k = 0; k < N; ++k) {
+                    size_t bucket = order[k];
+                    if (bucketSize[bucket] == 0) {
+                        break;
+                    }
+
+                    if (bucketSize[bucket] == 1) {
+                        size_t key = 0;
+                        while (!unique[key] || hashes[key] % N != bucket) {
+                            ++key;
+                        }
+                        size_t slot = 0;
+                        while (used[slot]) {
+                            ++slot;
+                        }
+                        used[slot] = true;
+                        table.names[slot] = keys[key];
+                        table.indices[slot] = static_cast<int>(key);
+                        table.displacement[bucket] = -static_cast<int64_t>(slot) - 1;
+                        continue;
+                    }
+
+                    for (int64_t seed = 1;; ++seed) {
+                        if (seed > max_seed) {
+                            throw std::logic_error("name_hash_table: no displacement seed found");
+                        }
+                        std::array<size_t, N> slots{};
+                        size_t count = 0;
+                        bool fits = true;
+                        for (size_t key = 0; key < N && fits; ++key) {
+                            if (!unique[key] || hashes[key] % N != bucket) {
+                                continue;
+                            }
+                            size_t slot = static_cast<size_t>(mix(hashes[key], seed) % N);
+                            fits = !used[slot];
+                            for (size_t s = 0; s < count && fits; ++s) {
+                                fits = slots[s] != slot;
+                            }
+                            slots[count++] = slot;
+                        }
+                        if (!fits) {
+                            continue;
+                        }
+
+                        count = 0;
+                        for (size_t key = 0; key < N; ++key) {
+                            if (!unique[key] || hashes[key] % N != bucket) {
+                                continue;
+                            }
+                            size_t slot = slots[count++];
+                            used[slot] = true;
+                            table.names[slot] = keys[key];
+                            table.indices[slot] = static_cast<int>(key);
+                        }
+                        table.displacement[bucket] = seed;
+                        break;
+                    }
+                }
+            }
+            return table;
+        }
+    };
+
+    namespace detail {
+        template <typename Tuple, size_t... Is>
+        constexpr auto make_name_hash_table_impl(const Tuple& fields, std::index_sequence<Is...>) {
+            return name_hash_table<sizeof...(Is)>::build({std::get<Is>(fields).name_...});
+        }
+    }
+
+    // Perfect hash over the name_ of every field_traits in a TypeData tuple
+    template <typename Tuple>
+    constexpr auto make_name_hash_table(const Tuple& fields) {
+        return detail::make_name_hash_table_impl(fields, std::make_index_sequence<std::tuple_size_v<Tuple>>{});
+    }
+}
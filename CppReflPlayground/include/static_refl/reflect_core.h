@@ -1,5 +1,8 @@
 #pragma once
 #include "field_traits.h"
+#include "name_hash.h"
+#include <array>
+#include <functional>
 #include <stdexcept>
 #include <string_view>
 #include <optional>
@@ -65,15 +68,7 @@
  */
 namespace my_reflect::static_refl {
 
-	// Helper for finding function index by name in tuple
 	namespace detail {
-		template<typename Tuple, size_t... Is>
-		constexpr int find_function_index_impl(const Tuple& funcs, std::string_view name, std::index_sequence<Is...>) {
-			int result = -1;
-			((std::get<Is>(funcs).name_ == name ? (result = static_cast<int>(Is), true) : false) || ...);
-			return result;
-		}
-
 		// Helper for invoking function by index
 		template<size_t Index, typename Tuple, typename Instance, typename... Args>
 		auto invoke_by_index_impl(const Tuple& funcs, Instance& instance, Args&&... args) {
@@ -82,14 +77,6 @@ namespace my_reflect::static_refl {
 			return (instance.*(func_field.ptr_))(std::forward<Args>(args)...);
 		}
 
-		// Helper for finding variable index by name
-		template<typename Tuple, size_t... Is>
-		constexpr int find_variable_index_impl(const Tuple& vars, std::string_view name, std::index_sequence<Is...>) {
-			int result = -1;
-			((std::get<Is>(vars).name_ == name ? (result = static_cast<int>(Is), true) : false) || ...);
-			return result;
-		}
-
 		// Helper for getting variable by index
 		template<size_t Index, typename Tuple, typename Instance>
 		decltype(auto) get_by_index_impl(const Tuple& vars, Instance& instance) {
@@ -105,6 +92,106 @@ namespace my_reflect::static_refl {
 			const auto& var_field = std::get<Index>(vars);
 			instance.*(var_field.ptr_) = std::forward<Value>(value);
 		}
+
+		// ===== Runtime-name dispatch =====
+		// For each (instance, visitor) type there is one constexpr array of thunks indexed like
+		// the variables/functions tuple. A name lookup in the perfect hash gives the index, and the
+		// thunk hands the statically typed member to the visitor: no boxing, no allocation.
+
+		template<const auto& Fields>
+		constexpr size_t field_count_v = std::tuple_size_v<std::remove_cv_t<std::remove_reference_t<decltype(Fields)>>>;
+
+		template<const auto& Fields, size_t Index, typename Instance, typename Visitor>
+		void visit_variable(Instance& instance, Visitor& visitor) {
+			const auto& field = std::get<Index>(Fields);
+			if constexpr (std::decay_t<decltype(field)>::is_member()) {
+				visitor(instance.*(field.ptr_));
+			} else {
+				visitor(*field.ptr_);
+			}
+		}
+
+		template<const auto& Fields, typename Instance, typename Visitor, size_t... Is>
+		constexpr auto make_variable_dispatch(std::index_sequence<Is...>) {
+			return std::array<void(*)(Instance&, Visitor&), sizeof...(Is)>{&visit_variable<Fields, Is, Instance, Visitor>...};
+		}
+
+		template<const auto& Fields, typename Instance, typename Visitor>
+		inline constexpr auto variable_dispatch_v =
+			make_variable_dispatch<Fields, Instance, Visitor>(std::make_index_sequence<field_count_v<Fields>>{});
+
+		template<const auto& Fields, const auto& NameTable, typename Instance, typename Visitor>
+		bool get_by_name_impl(Instance& instance, std::string_view name, Visitor& visitor) {
+			int index = NameTable.find(name);
+			if (index < 0) {
+				return false;
+			}
+			variable_dispatch_v<Fields, Instance, Visitor>[index](instance, visitor);
+			return true;
+		}
+
+		// Visitor used by set_by_name: assigns only when the member accepts the value
+		template<typename Value>
+		struct assign_visitor {
+			Value&& value;
+			bool assigned = false;
+
+			template<typename Member>
+			void operator()(Member& member) {
+				if constexpr (std::is_assignable_v<Member&, Value>) {
+					member = std::forward<Value>(value);
+					assigned = true;
+				}
+			}
+		};
+
+		template<const auto& Fields, size_t Index, typename Instance, typename Visitor, typename... Args>
+		bool call_function(Instance& instance, Visitor& visitor, Args&&... args) {
+			const auto& field = std::get<Index>(Fields);
+			using FuncPtr = decltype(field.ptr_);
+			if constexpr (std::decay_t<decltype(field)>::is_member()) {
+				if constexpr (std::is_invocable_v<FuncPtr, Instance&, Args...>) {
+					if constexpr (std::is_void_v<std::invoke_result_t<FuncPtr, Instance&, Args...>>) {
+						std::invoke(field.ptr_, instance, std::forward<Args>(args)...);
+					} else {
+						visitor(std::invoke(field.ptr_, instance, std::forward<Args>(args)...));
+					}
+					return true;
+				} else {
+					return false;
+				}
+			} else {
+				if constexpr (std::is_invocable_v<FuncPtr, Args...>) {
+					if constexpr (std::is_void_v<std::invoke_result_t<FuncPtr, Args...>>) {
+						std::invoke(field.ptr_, std::forward<Args>(args)...);
+					} else {
+						visitor(std::invoke(field.ptr_, std::forward<Args>(args)...));
+					}
+					return true;
+				} else {
+					return false;
+				}
+			}
+		}
+
+		template<const auto& Fields, typename Instance, typename Visitor, typename... Args, size_t... Is>
+		constexpr auto make_function_dispatch(std::index_sequence<Is...>) {
+			return std::array<bool(*)(Instance&, Visitor&, Args&&...), sizeof...(Is)>{
+				&call_function<Fields, Is, Instance, Visitor, Args...>...};
+		}
+
+		template<const auto& Fields, typename Instance, typename Visitor, typename... Args>
+		inline constexpr auto function_dispatch_v =
+			make_function_dispatch<Fields, Instance, Visitor, Args...>(std::make_index_sequence<field_count_v<Fields>>{});
+
+		template<const auto& Fields, const auto& NameTable, typename Instance, typename Visitor, typename... Args>
+		bool invoke_by_name_impl(Instance& instance, std::string_view name, Visitor& visitor, Args&&... args) {
+			int index = NameTable.find(name);
+			if (index < 0) {
+				return false;
+			}
+			return function_dispatch_v<Fields, Instance, Visitor, Args...>[index](instance, visitor, std::forward<Args>(args)...);
+		}
 	}
 
 	// Helper to extract class type from function tuple
@@ -151,22 +238,40 @@ namespace my_reflect::static_refl {
     #define functions(...)\
         static constexpr auto functions = std::make_tuple(__VA_ARGS__);\
 		using function_types = type_list_from_tuple_t<decltype(functions)>;\
+		static constexpr auto function_name_table = make_name_hash_table(functions);\
 		\
+		/* O(1): one hash, one probe and one string compare, at compile time or runtime */\
 		static constexpr int find_function_index(std::string_view funcName) {\
-			return detail::find_function_index_impl(functions, funcName, std::make_index_sequence<std::tuple_size_v<decltype(functions)>>{});\
+			return function_name_table.find(funcName);\
 		}\
 		\
 		template<size_t Index, typename... Args>\
 		static auto invoke(type_identity_t<get_class_type_t<decltype(functions)>>& instance, Args&&... args) {\
 			return detail::invoke_by_index_impl<Index>(functions, instance, std::forward<Args>(args)...);\
+		}\
+		\
+		/* Calls the function named funcName with args and passes a non-void result to visitor. */\
+		/* False if there is no such function or it cannot be called with these arguments. */\
+		template<typename Visitor, typename... Args>\
+		static bool invoke_by_name(type_identity_t<get_class_type_t<decltype(functions)>>& instance,\
+		                           std::string_view funcName, Visitor&& visitor, Args&&... args) {\
+			return detail::invoke_by_name_impl<functions, function_name_table>(instance, funcName, visitor, std::forward<Args>(args)...);\
+		}\
+		\
+		template<typename Visitor, typename... Args>\
+		static bool invoke_by_name(const type_identity_t<get_class_type_t<decltype(functions)>>& instance,\
+		                           std::string_view funcName, Visitor&& visitor, Args&&... args) {\
+			return detail::invoke_by_name_impl<functions, function_name_table>(instance, funcName, visitor, std::forward<Args>(args)...);\
 		}
 
     #define variables(...)\
         static constexpr auto variables = std::make_tuple(__VA_ARGS__);\
         using variable_types = type_list_from_tuple_t<decltype(variables)>;\
+        static constexpr auto variable_name_table = make_name_hash_table(variables);\
         \
+        /* O(1): one hash, one probe and one string compare, at compile time or runtime */\
         static constexpr int find_variable_index(std::string_view varName) {\
-            return detail::find_variable_index_impl(variables, varName, std::make_index_sequence<std::tuple_size_v<decltype(variables)>>{});\
+            return variable_name_table.find(varName);\
         }\
         \
         template<size_t Index>\
@@ -182,6 +287,27 @@ namespace my_reflect::static_refl {
         template<size_t Index, typename Value>\
         static void set(type_identity_t<get_var_class_type_t<decltype(variables)>>& instance, Value&& value) {\
             detail::set_by_index_impl<Index>(variables, instance, std::forward<Value>(value));\
+        }\
+        \
+        /* Passes the variable named varName (statically typed) to visitor; false if not found */\
+        template<typename Visitor>\
+        static bool get_by_name(type_identity_t<get_var_class_type_t<decltype(variables)>>& instance,\
+                                std::string_view varName, Visitor&& visitor) {\
+            return detail::get_by_name_impl<variables, variable_name_table>(instance, varName, visitor);\
+        }\
+        \
+        template<typename Visitor>\
+        static bool get_by_name(const type_identity_t<get_var_class_type_t<decltype(variables)>>& instance,\
+                                std::string_view varName, Visitor&& visitor) {\
+            return detail::get_by_name_impl<variables, variable_name_table>(instance, varName, visitor);\
+        }\
+        \
+        /* Assigns value to the variable named varName; false if not found or not assignable from value */\
+        template<typename Value>\
+        static bool set_by_name(type_identity_t<get_var_class_type_t<decltype(variables)>>& instance,\
+                                std::string_view varName, Value&& value) {\
+            detail::assign_visitor<Value> visitor{std::forward<Value>(value)};\
+            return detail::get_by_name_impl<variables, variable_name_table>(instance, varName, visitor) && visitor.assigned;\
         }
 
     #define containers(...)\
@@ -0,0 +1,333 @@
+//
+// Created by qianq on 1/5/2026.
+//
+// Structure-of-arrays storage generated from TypeData<T>::variables: one contiguous
+// column per reflected variable, so a scan over one field only touches that field's memory.
+//
+// Columns follow the variables() order and are addressed by the same index that
+// TypeData<T>::find_variable_index returns. Variables that are not listed in variables()
+// (including containers) are not stored and come back default-initialized.
+
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "reflect_core.h"
+
+namespace my_reflect::static_refl {
+
+    /**
+     * @brief Non-owning view of a contiguous column.
+     *
+     * @tparam V Element type (const for read-only columns)
+     */
+    template <typename V>
+    class soa_span {
+    public:
+        constexpr soa_span() = default;
+        constexpr soa_span(V* data, size_t size) : data_(data), size_(size) {}
+
+        constexpr V* data() const { return data_; }
+        constexpr size_t size() const { return size_; }
+        constexpr bool empty() const { return size_ == 0; }
+
+        constexpr V& operator[](size_t i) const { return data_[i]; }
+        constexpr V* begin() const { return data_; }
+        constexpr V* end() const { return data_ + size_; }
+
+    private:
+        V* data_ = nullptr;
+        size_t size_ = 0;
+    };
+
+    namespace detail {
+        // Growable array of one column. Not a std::vector so that bool columns stay addressable.
+        // Storage is uninitialized past size(), so V only has to be constructible from the values
+        // pushed into it. Growth is left to soa_vector, which sizes every column before writing.
+        template <typename V>
+        class soa_column {
+        public:
+            soa_column() = default;
+
+            soa_column(soa_column&& other) noexcept
+                : data_(std::exchange(other.data_, nullptr)),
+                  size_(std::exchange(other.size_, 0)),
+                  capacity_(std::exchange(other.capacity_, 0)) {}
+
+            // Delegates to the default constructor, so the destructor frees the block if a copy throws
+            soa_column(const soa_column& other) : soa_column() {
+                reserve(other.size_);
+                std::uninitialized_copy(other.data_, other.data_ + other.size_, data_);
+                size_ = other.size_;
+            }
+
+            soa_column& operator=(soa_column other) noexcept {
+                std::swap(data_, other.data_);
+                std::swap(size_, other.size_);
+                std::swap(capacity_, other.capacity_);
+                return *this;
+            }
+
+            ~soa_column() {
+                clear();
+                std::allocator<V>().deallocate(data_, capacity_);
+            }
+
+            size_t size() const { return size_; }
+            size_t capacity() const { return capacity_; }
+            V* data() { return data_; }
+            const V* data() const { return data_; }
+
+            // Moves the elements when that cannot throw, otherwise copies them so a throwing
+            // copy leaves this column unchanged
+            void reserve(size_t capacity) {
+                if (capacity <= capacity_) {
+                    return;
+                }
+                std::allocator<V> allocator;
+                V* grown = allocator.allocate(capacity);
+                try {
+                    if constexpr (std::is_nothrow_move_constructible_v<V> || !std::is_copy_constructible_v<V>) {
+                        std::uninitialized_move(data_, data_ + size_, grown);
+                    } else {
+                        std::uninitialized_copy(data_, data_ + size_, grown);
+                    }
+                } catch (...) {
+                    allocator.deallocate(grown, capacity);
+                    throw;
+                }
+                std::destroy(data_, data_ + size_);
+                allocator.deallocate(data_, capacity_);
+                data_ = grown;
+                capacity_ = capacity;
+            }
+
+            // Requires size() < capacity()
+            template <typename U>
+            void emplace_back(U&& value) {
+                ::new (static_cast<void*>(data_ + size_)) V(std::forward<U>(value));
+                ++size_;
+            }
+
+            void pop_back() {
+                std::destroy_at(data_ + --size_);
+            }
+
+            void clear() {
+                std::destroy(data_, data_ + size_);
+                size_ = 0;
+            }
+
+        private:
+            V* data_ = nullptr;
+            size_t size_ = 0;
+            size_t capacity_ = 0;
+        };
+
+        template <typename T, size_t I>
+        using soa_value_t = std::remove_cv_t<variable_traits_t<
+            decltype(std::get<I>(TypeData<T>::variables).ptr_)>>;
+
+        template <typename T, typename Indices>
+        struct soa_columns;
+
+        template <typename T, size_t... Is>
+        struct soa_columns<T, std::index_sequence<Is...>> {
+            using type = std::tuple<soa_column<soa_value_t<T, Is>>...>;
+        };
+
+        template <typename T, size_t... Is>
+        constexpr bool all_member_variables(std::index_sequence<Is...>) {
+            return (std::decay_t<decltype(std::get<Is>(TypeData<T>::variables))>::is_member() && ...);
+        }
+    }
+
+    /**
+     * @brief Column-per-field container for a reflected type.
+     *
+     * @tparam T A type with a BEGIN_REFLECT ... variables(...) block
+     *
+     * Usage:
+     * @code
+     * soa_vector<Particle> particles;
+     * particles.push_back(Particle{...});
+     *
+     * constexpr int x = TypeData<Particle>::find_variable_index("x");
+     * for (float& value : particles.column<x>()) { value += 1.0f; }
+     *
+     * particles.visit_column("mass", [](auto column) { ... });  // runtime name
+     * Particle p = particles[0];                                 // row proxy converts back to T
+     * @endcode
+     */
+    template <typename T>
+    class soa_vector {
+        using Type = TypeData<T>;
+        static constexpr size_t N = std::tuple_size_v<std::decay_t<decltype(Type::variables)>>;
+        using Indices = std::make_index_sequence<N>;
+
+        static_assert(N > 0, "soa_vector: type has no reflected variables");
+        static_assert(detail::all_member_variables<T>(Indices{}),
+                      "soa_vector: static variables have no per-row value and cannot be columns");
+
+    public:
+        static constexpr size_t column_count = N;
+
+        template <size_t I>
+        using column_value_t = detail::soa_value_t<T, I>;
+
+        // Column index of a variable name, -1 if not reflected (usable in constant expressions)
+        static constexpr int column_index(std::string_view name) {
+            return Type::find_variable_index(name);
+        }
+
+        /**
+         * @brief Proxy for one row; reads and writes go to the columns.
+         */
+        template <bool Const>
+        class basic_row {
+            using Owner = std::conditional_t<Const, const soa_vector, soa_vector>;
+
+        public:
+            basic_row(Owner& owner, size_t index) : owner_(&owner), index_(index) {}
+
+            template <size_t I>
+            decltype(auto) get() const { return owner_->template column<I>()[index_]; }
+
+            T load() const { return owner_->load(index_); }
+            operator T() const { return load(); }
+
+            template <bool C = Const, typename = std::enable_if_t<!C>>
+            const basic_row& operator=(const T& value) const {
+                owner_->store(index_, value);
+                return *this;
+            }
+
+        private:
+            Owner* owner_;
+            size_t index_;
+        };
+
+        using row = basic_row<false>;
+        using const_row = basic_row<true>;
+
+        size_t size() const { return std::get<0>(columns_).size(); }
+        bool empty() const { return size() == 0; }
+
+        // Rows that fit without reallocating any column
+        size_t capacity() const {
+            return std::apply([](const auto&... column) { return std::min({column.capacity()...}); }, columns_);
+        }
+
+        void reserve(size_t capacity) {
+            std::apply([capacity](auto&... column) { (column.reserve(capacity), ...); }, columns_);
+        }
+
+        void clear() {
+            std::apply([](auto&... column) { (column.clear(), ...); }, columns_);
+        }
+
+        void push_back(const T& value) { push_back_impl(value, Indices{}); }
+        void push_back(T&& value) { push_back_impl(std::move(value), Indices{}); }
+
+        void pop_back() {
+            std::apply([](auto&... column) { (column.pop_back(), ...); }, columns_);
+        }
+
+        row operator[](size_t index) { return row(*this, index); }
+        const_row operator[](size_t index) const { return const_row(*this, index); }
+
+        row at(size_t index) {
+            check_index(index);
+            return row(*this, index);
+        }
+
+        const_row at(size_t index) const {
+            check_index(index);
+            return const_row(*this, index);
+        }
+
+        template <size_t I>
+        soa_span<column_value_t<I>> column() {
+            auto& column = std::get<I>(columns_);
+            return {column.data(), column.size()};
+        }
+
+        template <size_t I>
+        soa_span<const column_value_t<I>> column() const {
+            const auto& column = std::get<I>(columns_);
+            return {column.data(), column.size()};
+        }
+
+        // Calls visitor with the span of the column named name; false if there is no such column
+        template <typename Visitor>
+        bool visit_column(std::string_view name, Visitor&& visitor) {
+            return visit_column_impl(*this, column_index(name), visitor, Indices{});
+        }
+
+        template <typename Visitor>
+        bool visit_column(std::string_view name, Visitor&& visitor) const {
+            return visit_column_impl(*this, column_index(name), visitor, Indices{});
+        }
+
+        // Reassembles row index as a T (requires T to be default constructible)
+        T load(size_t index) const {
+            T value{};
+            load_impl(index, value, Indices{});
+            return value;
+        }
+
+        void store(size_t index, const T& value) { store_impl(index, value, Indices{}); }
+
+    private:
+        // Every column is grown before any is written, and a throwing element constructor
+        // removes the values already pushed, so the columns always keep the same length.
+        // For an rvalue, the fields already moved out of value stay moved-from.
+        template <typename Value, size_t... Is>
+        void push_back_impl(Value&& value, std::index_sequence<Is...>) {
+            if (size() == capacity()) {
+                reserve(size() == 0 ? 8 : size() * 2);
+            }
+            size_t pushed = 0;
+            try {
+                if constexpr (std::is_lvalue_reference_v<Value>) {
+                    ((std::get<Is>(columns_).emplace_back(value.*(std::get<Is>(Type::variables).ptr_)), ++pushed), ...);
+                } else {
+                    ((std::get<Is>(columns_).emplace_back(std::move(value.*(std::get<Is>(Type::variables).ptr_))),
+                      ++pushed), ...);
+                }
+            } catch (...) {
+                ((Is < pushed ? std::get<Is>(columns_).pop_back() : void()), ...);
+                throw;
+            }
+        }
+
+        template <size_t... Is>
+        void load_impl(size_t index, T& value, std::index_sequence<Is...>) const {
+            ((value.*(std::get<Is>(Type::variables).ptr_) = std::get<Is>(columns_).data()[index]), ...);
+        }
+
+        template <size_t... Is>
+        void store_impl(size_t index, const T& value, std::index_sequence<Is...>) {
+            ((std::get<Is>(columns_).data()[index] = value.*(std::get<Is>(Type::variables).ptr_)), ...);
+        }
+
+        template <typename Self, typename Visitor, size_t... Is>
+        static bool visit_column_impl(Self& self, int index, Visitor& visitor, std::index_sequence<Is...>) {
+            return ((index == static_cast<int>(Is) ? (visitor(self.template column<Is>()), true) : false) || ...);
+        }
+
+        void check_index(size_t index) const {
+            if (index >= size()) {
+                throw std::out_of_range("soa_vector: row index out of range");
+            }
+        }
+
+        typename detail::soa_columns<T, Indices>::type columns_;
+    };
+}
@@ -1,5 +1,16 @@
 #pragma once
+#include <array>
+#include <cstddef>
+#include <tuple>
 #include <type_traits>
+#include <utility>
+
+// __has_builtin itself may be missing, so it cannot share an #if with the call
+#ifdef __has_builtin
+#if __has_builtin(__type_pack_element)
+#define MY_REFLECT_HAS_TYPE_PACK_ELEMENT 1
+#endif
+#endif
 
 namespace my_reflect::static_refl
 {
@@ -23,6 +34,37 @@ namespace my_reflect::static_refl
 
     namespace details
     {
+        // Algorithms below avoid peeling one type per instantiation: get is an overload-set lookup
+        // over a flat base list built once per type_list, and count/filter/reverse are folds or
+        // index_sequence expansions on top of it. Instantiation depth stays constant in N.
+
+        // indexer: inherits indexed<I, T> for each element, so overload resolution finds element I
+        template <std::size_t I, typename T>
+        struct indexed
+        {
+            using type = T;
+        };
+
+        template <typename, typename...>
+        struct indexer_impl;
+
+        template <std::size_t... Is, typename... Args>
+        struct indexer_impl<std::index_sequence<Is...>, Args...> : indexed<Is, Args>...
+        {
+        };
+
+        template <typename>
+        struct indexer;
+
+        template <typename... Args>
+        struct indexer<type_list<Args...>>
+        {
+            using type = indexer_impl<std::index_sequence_for<Args...>, Args...>;
+        };
+
+        template <std::size_t I, typename T>
+        indexed<I, T> select(const indexed<I, T>&);
+
         // head
         template <typename>
         struct head;
@@ -37,33 +79,26 @@ namespace my_reflect::static_refl
         template <typename, std::size_t>
         struct get;
 
-        template <typename T, typename... Remains>
-        struct get<type_list<T, Remains...>, 0>
-        {
-            using type = T;
-        };
-
-        template <typename T, typename... Remains, std::size_t N>
-        struct get<type_list<T, Remains...>, N>
+        template <typename... Args, std::size_t N>
+        struct get<type_list<Args...>, N>
         {
-            static_assert(N < sizeof...(Remains) + 1, "get<N>: index out of range");
-            using type = typename get<type_list<Remains...>, N - 1>::type;
+            static_assert(N < sizeof...(Args), "get<N>: index out of range");
+#ifdef MY_REFLECT_HAS_TYPE_PACK_ELEMENT
+            using type = __type_pack_element<N, Args...>;
+#else
+            using type = typename decltype(select<N>(std::declval<typename indexer<type_list<Args...>>::type>()))::type;
+#endif
         };
 
         // tail (last type)
         template <typename>
         struct tail;
 
-        template <typename T>
-        struct tail<type_list<T>>
-        {
-            using type = T;
-        };
-
-        template <typename T, typename... Remains>
-        struct tail<type_list<T, Remains...>>
+        template <typename... Args>
+        struct tail<type_list<Args...>>
         {
-            using type = typename tail<type_list<Remains...>>::type;
+            static_assert(sizeof...(Args) > 0, "tail: empty type_list");
+            using type = typename get<type_list<Args...>, sizeof...(Args) - 1>::type;
         };
 
         // concat
@@ -98,12 +133,9 @@ namespace my_reflect::static_refl
         template <typename, template <typename> typename>
         struct count;
 
-        template <template <typename> typename F>
-        struct count<type_list<>, F> : std::integral_constant<int, 0> {};
-
-        template <typename T, typename... Remains, template <typename> typename F>
-        struct count<type_list<T, Remains...>, F>
-            : std::integral_constant<int, (F<T>::value ? 1 : 0) + count<type_list<Remains...>, F>::value>
+        template <typename... Args, template <typename> typename F>
+        struct count<type_list<Args...>, F>
+            : std::integral_constant<int, (0 + ... + (F<Args>::value ? 1 : 0))>
         {
         };
 
@@ -121,37 +153,51 @@ namespace my_reflect::static_refl
         template <typename, template <typename> typename>
         struct filter;
 
-        template <template <typename> typename F>
-        struct filter<type_list<>, F>
+        // Positions of the kept elements, computed as a constexpr array in one pass
+        template <template <typename> typename F, typename... Args>
+        struct filter_indices
         {
-            using type = type_list<>;
+            static constexpr bool keep[] = {false, F<Args>::value...}; // leading entry keeps the array non-empty
+            static constexpr std::size_t size = (0 + ... + (F<Args>::value ? 1 : 0));
+
+            static constexpr auto build()
+            {
+                std::array<std::size_t, size + 1> result{};
+                std::size_t next = 0;
+                for (std::size_t i = 0; i < sizeof...(Args); ++i)
+                {
+                    if (keep[i + 1])
+                    {
+                        result[next++] = i;
+                    }
+                }
+                return result;
+            }
+
+            static constexpr auto value = build();
         };
 
-        template <typename T, typename... Remains, template <typename> typename F>
-        struct filter<type_list<T, Remains...>, F>
+        template <typename List, typename Indices, std::size_t... Is>
+        auto pick(std::index_sequence<Is...>) -> type_list<typename get<List, Indices::value[Is]>::type...>;
+
+        template <typename... Args, template <typename> typename F>
+        struct filter<type_list<Args...>, F>
         {
-            using rest = typename filter<type_list<Remains...>, F>::type;
-            using type = std::conditional_t<
-                F<T>::value,
-                typename push<T, rest>::type, // push_front
-                rest>;
+            using indices = filter_indices<F, Args...>;
+            using type = decltype(pick<type_list<Args...>, indices>(std::make_index_sequence<indices::size>{}));
         };
 
         // reverse
         template <typename>
         struct reverse;
 
-        template <>
-        struct reverse<type_list<>>
-        {
-            using type = type_list<>;
-        };
+        template <typename List, std::size_t... Is>
+        auto reverse_impl(std::index_sequence<Is...>) -> type_list<typename get<List, List::size - 1 - Is>::type...>;
 
-        template <typename T, typename... Remains>
-        struct reverse<type_list<T, Remains...>>
+        template <typename... Args>
+        struct reverse<type_list<Args...>>
         {
-            using rest_rev = typename reverse<type_list<Remains...>>::type;
-            using type = typename push<rest_rev, T>::type; // push_back
+            using type = decltype(reverse_impl<type_list<Args...>>(std::index_sequence_for<Args...>{}));
         };
 
         // build from tuple
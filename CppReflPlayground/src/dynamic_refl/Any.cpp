@@ -9,86 +9,78 @@ namespace my_reflect::dynamic_refl {
 
 // Any constructors and destructor
 Any::Any(const Any& other)
-	: typeInfo(other.typeInfo), storageType(other.storageType), ops(other.ops) {
-	if (ops.copy) {
-		auto new_any = ops.copy(other);
-		payload = new_any.payload;
-		new_any.payload = nullptr;
-		new_any.ops.destroy = nullptr;
+	: typeInfo(other.typeInfo), payload(other.payload), storageType(other.storageType),
+	  typeId(other.typeId), ops(other.ops) {
+	if (storageType == storage_type::Ref || storageType == storage_type::ConstRef) {
+		// References alias the same object, nothing to copy
+		return;
+	}
+	payload = nullptr;
+	if (ops && ops->copy && storageType != storage_type::Empty) {
+		auto new_any = ops->copy(other);
+		steal(new_any);
 	} else {
 		storageType = storage_type::Empty;
 		typeInfo = nullptr;
+		typeId = 0;
 	}
 }
 
-Any::Any(Any&& other) noexcept
-	: typeInfo(other.typeInfo)
-	, payload(other.payload)
-	, storageType(other.storageType)
-	, ops(other.ops) {
-	other.typeInfo = nullptr;
-	other.payload = nullptr;
-	other.storageType = storage_type::Empty;
-	other.ops = {};
+Any::Any(Any&& other) noexcept {
+	steal(other);
 }
 
 Any& Any::operator=(const Any& other) {
 	if (this != &other) {
-		// Destroy current content
-		if (ops.destroy != nullptr) {
-			if (storageType == storage_type::Copy || storageType == storage_type::Move) {
-				ops.destroy(*this);
-			}
-		}
-
-		// Copy from other
-		typeInfo = other.typeInfo;
-		storageType = other.storageType;
-		ops = other.ops;
-
-		if (ops.copy) {
-			auto new_any = ops.copy(other);
-			payload = new_any.payload;
-			new_any.payload = nullptr;
-			new_any.ops.destroy = nullptr;
-		} else {
-			storageType = storage_type::Empty;
-			typeInfo = nullptr;
-			payload = nullptr;
-		}
+		Any tmp(other);
+		reset();
+		steal(tmp);
 	}
 	return *this;
 }
 
 Any& Any::operator=(Any&& other) noexcept {
 	if (this != &other) {
-		// Destroy current content
-		if (ops.destroy != nullptr) {
-			if (storageType == storage_type::Copy || storageType == storage_type::Move) {
-				ops.destroy(*this);
-			}
-		}
-
-		// Move from other
-		typeInfo = other.typeInfo;
-		payload = other.payload;
-		storageType = other.storageType;
-		ops = other.ops;
-
-		other.typeInfo = nullptr;
-		other.payload = nullptr;
-		other.storageType = storage_type::Empty;
-		other.ops = {};
+		reset();
+		steal(other);
 	}
 	return *this;
 }
 
 Any::~Any() {
-	if (ops.destroy != nullptr) {
+	reset();
+}
+
+void Any::reset() noexcept {
+	if (ops && ops->destroy != nullptr) {
 		if (storageType == storage_type::Copy || storageType == storage_type::Move) {
-			ops.destroy(*this);
+			ops->destroy(*this);
 		}
 	}
+	typeInfo = nullptr;
+	payload = nullptr;
+	storageType = storage_type::Empty;
+	typeId = 0;
+	ops = nullptr;
+}
+
+void Any::steal(Any& other) noexcept {
+	typeInfo = other.typeInfo;
+	storageType = other.storageType;
+	typeId = other.typeId;
+	ops = other.ops;
+	if (other.is_inline()) {
+		// Inline payloads live inside other, so they must be moved over
+		ops->relocate(*this, other);
+	} else {
+		payload = other.payload;
+	}
+
+	other.typeInfo = nullptr;
+	other.payload = nullptr;
+	other.storageType = storage_type::Empty;
+	other.typeId = 0;
+	other.ops = nullptr;
 }
 
 bool Any::empty() const {
@@ -103,4 +95,25 @@ Any::storage_type Any::storage() const {
 	return storageType; 
 }
 
+bool Any::is_inline() const {
+	return payload != nullptr && payload == buffer;
+}
+
+bool Any::equals(const Any& other) const {
+	if (typeInfo == nullptr || typeInfo != other.typeInfo) {
+		return false;
+	}
+	if (!ops || !ops->equal) {
+		return false;
+	}
+	return ops->equal(*this, other);
+}
+
+size_t Any::hash() const {
+	if (!ops || !ops->hash) {
+		throw std::runtime_error("Type is not hashable");
+	}
+	return ops->hash(*this);
+}
+
 } // namespace my_reflect::dynamic_refl
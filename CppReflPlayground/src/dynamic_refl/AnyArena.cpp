@@ -0,0 +1,88 @@
+//
+// Created by qianq on 1/5/2026.
+//
+
+#include "../../include/dynamic_refl/AnyArena.h"
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+
+namespace my_reflect::dynamic_refl {
+
+AnyArena::AnyArena(size_t blockSize)
+	: blockSize_(blockSize) {}
+
+AnyArena::AnyArena(void* buffer, size_t size, size_t blockSize)
+	: blockSize_(blockSize) {
+	blocks_.push_back({static_cast<std::byte*>(buffer), size, nullptr});
+	enter_block(0);
+}
+
+void AnyArena::enter_block(size_t index) {
+	if (!blocks_.empty() && cursor_ != nullptr) {
+		usedInFullBlocks_ += static_cast<size_t>(cursor_ - blocks_[active_].data);
+	}
+	active_ = index;
+	cursor_ = blocks_[index].data;
+	end_ = cursor_ + blocks_[index].size;
+}
+
+void* AnyArena::allocate_slow(size_t size, size_t alignment) {
+	// Blocks kept by reset() come first; only grow when none of them fits
+	for (size_t next = cursor_ == nullptr ? 0 : active_ + 1; next < blocks_.size(); ++next) {
+		if (blocks_[next].size >= size + alignment) {
+			enter_block(next);
+			return allocate(size, alignment);
+		}
+	}
+
+	size_t blockSize = blockSize_;
+	if (!blocks_.empty()) {
+		blockSize = std::max(blockSize, blocks_.back().size * 2);
+	}
+	blockSize = std::max(blockSize, size + alignment);
+
+	auto owned = std::make_unique<std::byte[]>(blockSize);
+	std::byte* data = owned.get();
+	blocks_.push_back({data, blockSize, std::move(owned)});
+	enter_block(blocks_.size() - 1);
+	return allocate(size, alignment);
+}
+
+void AnyArena::reset() noexcept {
+	// Keep the caller buffer (always first) and the newest, largest owned block. Compacted in
+	// place: moving a Block and erasing the tail never allocate.
+	static_assert(std::is_nothrow_move_constructible_v<Block> && std::is_nothrow_move_assignable_v<Block>,
+	              "reset() moves blocks inside a noexcept function");
+	size_t keep = !blocks_.empty() && !blocks_.front().owned ? 1 : 0;
+	if (blocks_.size() > keep && blocks_.back().owned) {
+		std::swap(blocks_[keep], blocks_.back());
+		++keep;
+	}
+	blocks_.erase(blocks_.begin() + static_cast<std::ptrdiff_t>(keep), blocks_.end());
+
+	usedInFullBlocks_ = 0;
+	cursor_ = nullptr;
+	end_ = nullptr;
+	active_ = 0;
+	if (!blocks_.empty()) {
+		enter_block(0);
+	}
+}
+
+size_t AnyArena::used() const {
+	if (cursor_ == nullptr) {
+		return 0;
+	}
+	return usedInFullBlocks_ + static_cast<size_t>(cursor_ - blocks_[active_].data);
+}
+
+size_t AnyArena::capacity() const {
+	size_t total = 0;
+	for (const Block& block : blocks_) {
+		total += block.size;
+	}
+	return total;
+}
+
+} // namespace my_reflect::dynamic_refl
@@ -6,8 +6,8 @@
 
 namespace my_reflect::dynamic_refl {
 
-    Arithmetic::Arithmetic(const Kind kind, const bool isSigned)
-        : Type(getName(kind), Type::Kind::Arithmetic), kind_(kind), isSigned_(isSigned) {
+    Arithmetic::Arithmetic(const Kind kind, const bool isSigned, const size_t size)
+        : Type(getName(kind), Type::Kind::Arithmetic), kind_(kind), isSigned_(isSigned), size_(size) {
     }
 
     std::string Arithmetic::getName(Kind kind) {
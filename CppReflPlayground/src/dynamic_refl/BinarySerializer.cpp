@@ -0,0 +1,298 @@
+//
+// Created by qianq on 1/4/2026.
+//
+
+#include "../../include/dynamic_refl/BinarySerializer.h"
+#include "../../include/dynamic_refl/Any.h"
+#include "../../include/dynamic_refl/Arithmetic.h"
+#include "../../include/dynamic_refl/Class.h"
+#include "../../include/dynamic_refl/dynamic_reflect_core.h"
+#include "../../include/dynamic_refl/Enum.h"
+#include "../../include/dynamic_refl/TypeRegistry.h"
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace my_reflect::dynamic_refl {
+
+    // ========== Codec and Program Tables ==========
+
+    namespace {
+        // Leaf codecs by TypeId. Only read while compiling, so a plain mutex is enough.
+        struct CodecTable {
+            CodecTable() {
+                codecs.emplace(GetType<std::string>()->GetId(), BinaryCodec::Create<std::string>());
+            }
+
+            std::mutex mutex;
+            std::unordered_map<TypeId, BinaryCodec> codecs;
+        };
+
+        CodecTable& Codecs() {
+            static CodecTable table;
+            return table;
+        }
+
+        BinaryCodec FindCodec(const Class& cls) {
+            CodecTable& table = Codecs();
+            std::lock_guard<std::mutex> lock(table.mutex);
+            auto it = table.codecs.find(cls.GetId());
+            return it != table.codecs.end() ? it->second : BinaryCodec{};
+        }
+
+        struct CompiledProgram {
+            BinaryProgram program;
+            size_t memberCount;  // bases + variables + containers of the class when compiled
+        };
+
+        size_t MemberCount(const Class& cls) {
+            return cls.GetBaseClasses().size() + cls.GetMemberVariables().size() + cls.GetMemberContainers().size();
+        }
+
+        // Compiled programs by TypeId. TypeIds are dense, so slots live in fixed-size chunks that
+        // are allocated on demand and never move: lookups are two atomic loads and no lock.
+        class ProgramTable {
+        public:
+            const BinaryProgram& Get(const Class& cls, const void* instance) {
+                TypeId id = cls.GetId();
+                if (id / kChunkSize >= kChunkCount) {
+                    throw std::runtime_error("Binary program table is full (type id " + std::to_string(id) + ")");
+                }
+                if (const Chunk* chunk = chunks_[id / kChunkSize].load(std::memory_order_acquire)) {
+                    const CompiledProgram* compiled = (*chunk)[id % kChunkSize].load(std::memory_order_acquire);
+                    if (compiled && compiled->memberCount == MemberCount(cls)) {
+                        return compiled->program;
+                    }
+                }
+                return Compile(cls, instance);
+            }
+
+        private:
+            static constexpr size_t kChunkSize = 1024;
+            static constexpr size_t kChunkCount = 1024;
+            using Chunk = std::array<std::atomic<const CompiledProgram*>, kChunkSize>;
+
+            const BinaryProgram& Compile(const Class& cls, const void* instance) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                TypeId id = cls.GetId();
+                Chunk* chunk = chunks_[id / kChunkSize].load(std::memory_order_acquire);
+                if (!chunk) {
+                    ownedChunks_.push_back(std::make_unique<Chunk>());
+                    chunk = ownedChunks_.back().get();
+                    chunks_[id / kChunkSize].store(chunk, std::memory_order_release);
+                }
+                std::atomic<const CompiledProgram*>& slot = (*chunk)[id % kChunkSize];
+                const CompiledProgram* compiled = slot.load(std::memory_order_acquire);
+                if (compiled && compiled->memberCount == MemberCount(cls)) {
+                    return compiled->program;
+                }
+                compiledPrograms_.push_back(std::make_unique<const CompiledProgram>(
+                    CompiledProgram{BinaryProgram::Compile(cls, instance), MemberCount(cls)}));
+                slot.store(compiledPrograms_.back().get(), std::memory_order_release);
+                return compiledPrograms_.back()->program;
+            }
+
+            std::array<std::atomic<Chunk*>, kChunkCount> chunks_{};
+            std::mutex mutex_;
+            std::vector<std::unique_ptr<Chunk>> ownedChunks_;
+            // Every compiled program stays alive, so references handed out are never invalidated
+            std::vector<std::unique_ptr<const CompiledProgram>> compiledPrograms_;
+        };
+
+        ProgramTable& Programs() {
+            static ProgramTable table;
+            return table;
+        }
+    }
+
+    void RegisterBinaryCodec(const Type* type, BinaryCodec codec) {
+        CodecTable& table = Codecs();
+        std::lock_guard<std::mutex> lock(table.mutex);
+        table.codecs[type->GetId()] = codec;
+    }
+
+    const BinaryProgram& GetBinaryProgram(const Class& cls, const void* instance) {
+        return Programs().Get(cls, instance);
+    }
+
+    // ========== Program Compilation ==========
+
+    namespace {
+        void AppendRaw(std::vector<BinaryProgram::Op>& ops, size_t offset, size_t size) {
+            // Fields that sit back to back in memory become one memcpy
+            if (!ops.empty()) {
+                BinaryProgram::Op& last = ops.back();
+                if (last.kind == BinaryProgram::OpKind::Raw && last.offset + last.size == offset) {
+                    last.size += static_cast<uint32_t>(size);
+                    return;
+                }
+            }
+            ops.push_back({BinaryProgram::OpKind::Raw, static_cast<uint32_t>(offset), static_cast<uint32_t>(size)});
+        }
+
+        void CompileClass(const Class& cls, const std::byte* instance, size_t baseOffset,
+                          std::vector<BinaryProgram::Op>& ops);
+
+        // Size of a type that is copied as raw bytes, 0 for everything else
+        size_t RawSize(const Type* type) {
+            switch (type->GetKind()) {
+                case Type::Kind::Arithmetic: return type->AsArithmetic()->GetSize();
+                case Type::Kind::Enum: return type->AsEnum()->GetUnderlyingSize();
+                case Type::Kind::Pointer: return sizeof(void*);
+                default: return 0;
+            }
+        }
+
+        // A class that was never registered has no members, so it would encode as nothing and
+        // its value would be lost. A registered empty class legitimately encodes as nothing.
+        bool IsUnregisteredLeaf(const Class& cls) {
+            return !FindCodec(cls).encode && cls.GetBaseClasses().empty() && cls.GetMemberVariables().empty()
+                && cls.GetMemberContainers().empty() && TypeRegistry::Instance().GetTypeByName(cls.GetName()) != &cls;
+        }
+
+        void CompileField(const Type* type, const std::byte* instance, size_t offset, const std::string& name,
+                          std::vector<BinaryProgram::Op>& ops) {
+            if (type->GetKind() == Type::Kind::Class) {
+                if (IsUnregisteredLeaf(*type->AsClass())) {
+                    throw std::runtime_error("Member '" + name + "' has a class type that is not registered "
+                                             "and has no binary codec");
+                }
+                CompileClass(*type->AsClass(), instance, offset, ops);
+                return;
+            }
+            size_t size = RawSize(type);
+            if (size == 0) {
+                throw std::runtime_error("Member '" + name + "' of type '" + type->GetName() +
+                                         "' is not binary serializable");
+            }
+            AppendRaw(ops, offset, size);
+        }
+
+        // instance is the outermost object; the class being compiled lives at instance + baseOffset
+        void CompileClass(const Class& cls, const std::byte* instance, size_t baseOffset,
+                          std::vector<BinaryProgram::Op>& ops) {
+            const std::byte* object = instance + baseOffset;
+            if (BinaryCodec codec = FindCodec(cls); codec.encode) {
+                ops.push_back({BinaryProgram::OpKind::Value, static_cast<uint32_t>(baseOffset), 0,
+                               codec.encode, codec.decode});
+                return;
+            }
+
+            if (IsUnregisteredLeaf(cls)) {
+                throw std::runtime_error("Class '" + cls.GetName() + "' is not registered and has no binary codec");
+            }
+
+            for (size_t i = 0; i < cls.GetBaseClasses().size(); ++i) {
+                CompileClass(*cls.GetBaseClasses()[i], instance, baseOffset + cls.GetBaseOffset(i, object), ops);
+            }
+
+            for (const auto& var : cls.GetMemberVariables()) {
+                if (!var.accessor_.get) {
+                    throw std::runtime_error("Member '" + var.name_ + "' was registered without a member pointer");
+                }
+                CompileField(var.type_, instance, baseOffset + var.accessor_.offset(object), var.name_, ops);
+            }
+
+            for (const auto& container : cls.GetMemberContainers()) {
+                if (!container.accessor_.get || !container.ops_.encode) {
+                    throw std::runtime_error("Member '" + container.name_ + "' was registered without a member pointer");
+                }
+                ops.push_back({BinaryProgram::OpKind::Container,
+                               static_cast<uint32_t>(baseOffset + container.accessor_.offset(object)), 0,
+                               container.ops_.encode, container.ops_.decode});
+            }
+        }
+    }
+
+    BinaryProgram BinaryProgram::Compile(const Class& cls, const void* instance) {
+        BinaryProgram program;
+        CompileClass(cls, static_cast<const std::byte*>(instance), 0, program.ops_);
+        return program;
+    }
+
+    // ========== Program Execution ==========
+
+    void BinaryProgram::Encode(const void* instance, BinaryWriter& out) const {
+        const auto* base = static_cast<const std::byte*>(instance);
+        for (const Op& op : ops_) {
+            if (op.kind == OpKind::Raw) {
+                out.write(base + op.offset, op.size);
+            } else {
+                op.encode(base + op.offset, out);
+            }
+        }
+    }
+
+    void BinaryProgram::Decode(void* instance, BinaryReader& in) const {
+        auto* base = static_cast<std::byte*>(instance);
+        for (const Op& op : ops_) {
+            if (op.kind == OpKind::Raw) {
+                in.read(base + op.offset, op.size);
+            } else if (op.decode) {
+                op.decode(base + op.offset, in);
+            } else {
+                throw std::runtime_error("Binary decode: member cannot be decoded");
+            }
+        }
+    }
+
+    // ========== Value Encoding ==========
+
+    void EncodeValue(const Type* type, const void* value, BinaryWriter& out) {
+        if (type->GetKind() == Type::Kind::Class) {
+            GetBinaryProgram(*type->AsClass(), value).Encode(value, out);
+            return;
+        }
+        size_t size = RawSize(type);
+        if (size == 0) {
+            throw std::runtime_error("Type '" + type->GetName() + "' is not binary serializable");
+        }
+        out.write(value, size);
+    }
+
+    void DecodeValue(const Type* type, void* value, BinaryReader& in) {
+        if (type->GetKind() == Type::Kind::Class) {
+            GetBinaryProgram(*type->AsClass(), value).Decode(value, in);
+            return;
+        }
+        size_t size = RawSize(type);
+        if (size == 0) {
+            throw std::runtime_error("Type '" + type->GetName() + "' is not binary serializable");
+        }
+        in.read(value, size);
+    }
+
+    void Serialize(const Any& value, BinaryWriter& out) {
+        if (value.empty()) {
+            throw std::runtime_error("Cannot serialize an empty Any");
+        }
+        EncodeValue(value.typeInfo, value.payload, out);
+    }
+
+    std::vector<std::byte> Serialize(const Any& value) {
+        BinaryWriter out;
+        Serialize(value, out);
+        return out.release();
+    }
+
+    void Deserialize(Any& value, BinaryReader& in) {
+        if (value.empty()) {
+            throw std::runtime_error("Cannot deserialize into an empty Any");
+        }
+        if (value.storage() == Any::storage_type::ConstRef) {
+            throw std::runtime_error("Cannot modify const reference Any");
+        }
+        DecodeValue(value.typeInfo, value.payload, in);
+    }
+
+    void Deserialize(Any& value, const std::vector<std::byte>& data) {
+        BinaryReader in(data);
+        Deserialize(value, in);
+        if (!in.done()) {
+            throw std::runtime_error("Binary decode: trailing bytes after value");
+        }
+    }
+
+}
@@ -17,46 +17,64 @@ namespace my_reflect::dynamic_refl {
     Class::Class(const std::string& name) : Type(name, Kind::Class) {}
 
     void Class::AddVar(MemberVariable &&variable) {
+        nameIndex_.Insert(variable.name_, NameIndex::Kind::Variable, static_cast<uint32_t>(memberVariables_.size()));
         memberVariables_.emplace_back(std::move(variable));
     }
 
     void Class::AddFunc(MemberFunction &&function) {
+        nameIndex_.Insert(function.name_, NameIndex::Kind::Function, static_cast<uint32_t>(memberFunctions_.size()));
         memberFunctions_.emplace_back(std::move(function));
     }
 
     void Class::AddContainer(MemberContainer &&container) {
+        nameIndex_.Insert(container.name_, NameIndex::Kind::Container, static_cast<uint32_t>(memberContainers_.size()));
         memberContainers_.emplace_back(std::move(container));
     }
 
+    void Class::AddBaseClass(const Class* base, Thunk<size_t(const void* instance)> offset) {
+        baseClasses_.push_back(base);
+        baseOffsets_.push_back(offset);
+    }
+
+    size_t Class::GetBaseOffset(size_t index, const void* instance) const {
+        return baseOffsets_[index] ? baseOffsets_[index](instance) : 0;
+    }
+
     // ========== Any Support Methods Implementation ==========
 
-    Any Class::GetMemberValue(Any& instance, const std::string& memberName) const {
-        if (instance.typeInfo->GetKind() != Type::Kind::Class) {
+    namespace {
+        const MemberAccessor& RequireAccessor(const MemberAccessor& accessor, std::string_view memberName) {
+            if (!accessor.get) {
+                throw std::runtime_error("Member '" + std::string(memberName) +
+                                         "' was registered without a member pointer");
+            }
+            return accessor;
+        }
+    }
+
+    Any Class::GetMemberValue(Any& instance, std::string_view memberName) const {
+        if (instance.typeInfo != this) {
             throw std::bad_cast();
         }
 
+        // View into the instance: ConstRef if the instance is read-only, Ref otherwise
+        const bool readOnly = instance.storage() == Any::storage_type::ConstRef;
+
         // Search in member variables
-        for (const auto& var : memberVariables_) {
-            if (var.name_ == memberName) {
-                // TODO: Need member pointer stored in MemberVariable to access the actual member
-                // For now, return empty Any
-                throw std::runtime_error("GetMemberValue not fully implemented - need member pointers");
-            }
+        if (const MemberVariable* var = FindVariable(memberName)) {
+            return RequireAccessor(var->accessor_, memberName).get(instance.payload, readOnly);
         }
 
         // Search in member containers
-        for (const auto& container : memberContainers_) {
-            if (container.name_ == memberName) {
-                // TODO: Need member pointer stored in MemberContainer
-                throw std::runtime_error("GetMemberValue not fully implemented - need member pointers");
-            }
+        if (const MemberContainer* container = FindContainer(memberName)) {
+            return RequireAccessor(container->accessor_, memberName).get(instance.payload, readOnly);
         }
 
-        throw std::runtime_error("Member '" + memberName + "' not found");
+        throw std::runtime_error("Member '" + std::string(memberName) + "' not found");
     }
 
-    bool Class::SetMemberValue(Any& instance, const std::string& memberName, const Any& value) const {
-        if (instance.typeInfo->GetKind() != Type::Kind::Class) {
+    bool Class::SetMemberValue(Any& instance, std::string_view memberName, const Any& value) const {
+        if (instance.typeInfo != this) {
             throw std::bad_cast();
         }
 
@@ -64,24 +82,40 @@ namespace my_reflect::dynamic_refl {
             throw std::runtime_error("Cannot modify const reference Any");
         }
 
-        // Search in member variables
-        for (const auto& var : memberVariables_) {
-            if (var.name_ == memberName) {
-                // TODO: Need member pointer stored in MemberVariable to access the actual member
-                throw std::runtime_error("SetMemberValue not fully implemented - need member pointers");
-            }
+        const MemberAccessor* accessor = nullptr;
+        if (const MemberVariable* var = FindVariable(memberName)) {
+            accessor = &RequireAccessor(var->accessor_, memberName);
+        } else if (const MemberContainer* container = FindContainer(memberName)) {
+            accessor = &RequireAccessor(container->accessor_, memberName);
+        } else {
+            throw std::runtime_error("Member '" + std::string(memberName) + "' not found");
         }
 
-        throw std::runtime_error("Member '" + memberName + "' not found");
+        if (!accessor->set) {
+            throw std::runtime_error("Member '" + std::string(memberName) + "' is not assignable");
+        }
+        return accessor->set(instance.payload, value);
     }
 
-    const MemberFunction* Class::FindFunction(const std::string& name) const {
-        for (const auto& func : memberFunctions_) {
-            if (func.name_ == name) {
-                return &func;
-            }
-        }
-        return nullptr;
+    // ========== Name Lookup Implementation ==========
+
+    template <typename Member>
+    const Member* Class::FindIn(const std::vector<Member>& members, const NameIndex& index,
+                                NameIndex::Kind kind, std::string_view name) {
+        int pos = index.Find(name, kind);
+        return pos == NameIndex::npos ? nullptr : &members[pos];
+    }
+
+    const MemberFunction* Class::FindFunction(std::string_view name) const {
+        return FindIn(memberFunctions_, nameIndex_, NameIndex::Kind::Function, name);
+    }
+
+    const MemberVariable* Class::FindVariable(std::string_view name) const {
+        return FindIn(memberVariables_, nameIndex_, NameIndex::Kind::Variable, name);
+    }
+
+    const MemberContainer* Class::FindContainer(std::string_view name) const {
+        return FindIn(memberContainers_, nameIndex_, NameIndex::Kind::Container, name);
     }
 
 }
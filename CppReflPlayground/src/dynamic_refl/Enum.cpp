@@ -15,9 +15,107 @@ namespace my_reflect::dynamic_refl {
     Enum::Enum(const std::string& name, size_t underlyingSize)
         : Type(name, Kind::Enum), underlyingSize_(underlyingSize) {}
 
+    namespace {
+        // Empty table entries allowed beyond one per item before value lookups fall back
+        // to binary search (covers small gaps and enums starting at 1)
+        constexpr unsigned long long kDenseSlack = 16;
+    }
+
+    // ========== Lookup Tables ==========
+
+    void Enum::AddItem(const std::string& name, long long value) {
+        nameIndex_.Insert(name, NameIndex::Kind::Enumerator, static_cast<uint32_t>(items_.size()));
+        items_.emplace_back(Item{name, value});
+        // Rebuilding here made registering n items O(n^2); the next value lookup rebuilds once
+        valueIndexReady_.store(false, std::memory_order_release);
+    }
+
+    void Enum::RebuildValueIndex() const {
+        std::lock_guard<std::mutex> lock(valueIndexMutex_);
+        if (valueIndexReady_.load(std::memory_order_relaxed)) {
+            return;  // another lookup rebuilt the tables first
+        }
+        denseItems_.clear();
+        sortedValues_.clear();
+        BuildValueTables();
+        valueIndexReady_.store(true, std::memory_order_release);
+    }
+
+    void Enum::BuildValueTables() const {
+        if (items_.empty()) {
+            return;
+        }
+
+        auto [minIt, maxIt] = std::minmax_element(items_.begin(), items_.end(),
+            [](const Item& a, const Item& b) { return a.value_ < b.value_; });
+        // Computed unsigned so that a range over the whole long long domain does not overflow
+        const unsigned long long span = static_cast<unsigned long long>(maxIt->value_)
+                                      - static_cast<unsigned long long>(minIt->value_);
+
+        if (span < items_.size() + kDenseSlack) {
+            denseMin_ = minIt->value_;
+            denseItems_.assign(static_cast<size_t>(span) + 1, -1);
+            for (size_t i = 0; i < items_.size(); ++i) {
+                int32_t& slot = denseItems_[static_cast<size_t>(
+                    static_cast<unsigned long long>(items_[i].value_) - static_cast<unsigned long long>(denseMin_))];
+                if (slot < 0) {
+                    slot = static_cast<int32_t>(i);
+                }
+            }
+            return;
+        }
+
+        sortedValues_.reserve(items_.size());
+        for (size_t i = 0; i < items_.size(); ++i) {
+            sortedValues_.emplace_back(items_[i].value_, static_cast<uint32_t>(i));
+        }
+        // Stable, so among equal values the first registered item comes first
+        std::stable_sort(sortedValues_.begin(), sortedValues_.end(),
+            [](const auto& a, const auto& b) { return a.first < b.first; });
+    }
+
+    const Enum::Item* Enum::FindItem(long long value) const {
+        if (!valueIndexReady_.load(std::memory_order_acquire)) {
+            RebuildValueIndex();
+        }
+        if (!denseItems_.empty()) {
+            const unsigned long long offset = static_cast<unsigned long long>(value)
+                                            - static_cast<unsigned long long>(denseMin_);
+            if (offset >= denseItems_.size() || denseItems_[static_cast<size_t>(offset)] < 0) {
+                return nullptr;
+            }
+            return &items_[static_cast<size_t>(denseItems_[static_cast<size_t>(offset)])];
+        }
+        auto it = std::lower_bound(sortedValues_.begin(), sortedValues_.end(), value,
+            [](const auto& entry, long long v) { return entry.first < v; });
+        if (it == sortedValues_.end() || it->first != value) {
+            return nullptr;
+        }
+        return &items_[it->second];
+    }
+
+    bool Enum::IsDense() const {
+        // A lookup builds the tables if they are stale; its result does not matter here
+        FindItem(0);
+        return !denseItems_.empty();
+    }
+
+    std::string_view Enum::FindName(long long value) const {
+        const Item* item = FindItem(value);
+        return item ? std::string_view(item->name_) : std::string_view{};
+    }
+
+    std::optional<long long> Enum::FindValue(std::string_view name) const {
+        int index = nameIndex_.Find(name, NameIndex::Kind::Enumerator);
+        if (index == NameIndex::npos) {
+            return std::nullopt;
+        }
+        return items_[static_cast<size_t>(index)].value_;
+    }
+
     // ========== Any Support Methods Implementation ==========
 
-    bool Enum::SetByName(Any& any, const std::string& name) const {
+    bool Enum::SetByName(Any& any, std::string_view name) const {
         if (any.typeInfo->GetKind() != Type::Kind::Enum) {
             throw std::bad_cast();
         }
@@ -27,21 +125,20 @@ namespace my_reflect::dynamic_refl {
         }
 
         // Find the enum value by name
-        auto it = std::find_if(items_.begin(), items_.end(),
-            [&name](const Item& item) { return item.name_ == name; });
-
-        if (it == items_.end()) {
+        std::optional<long long> found = FindValue(name);
+        if (!found) {
             return false; // Name not found
         }
+        const long long value = *found;
 
         // Set the value based on the underlying type size
         void* ptr = any.payload;
         if (ptr) {
             switch (underlyingSize_) {
-                case 1: *static_cast<uint8_t*>(ptr) = static_cast<uint8_t>(it->value_); break;
-                case 2: *static_cast<uint16_t*>(ptr) = static_cast<uint16_t>(it->value_); break;
-                case 4: *static_cast<uint32_t*>(ptr) = static_cast<uint32_t>(it->value_); break;
-                case 8: *static_cast<uint64_t*>(ptr) = static_cast<uint64_t>(it->value_); break;
+                case 1: *static_cast<uint8_t*>(ptr) = static_cast<uint8_t>(value); break;
+                case 2: *static_cast<uint16_t*>(ptr) = static_cast<uint16_t>(value); break;
+                case 4: *static_cast<uint32_t*>(ptr) = static_cast<uint32_t>(value); break;
+                case 8: *static_cast<uint64_t*>(ptr) = static_cast<uint64_t>(value); break;
                 default: return false;
             }
             return true;
@@ -60,10 +157,7 @@ namespace my_reflect::dynamic_refl {
         }
 
         // Check if the value exists in the enum
-        auto it = std::find_if(items_.begin(), items_.end(),
-            [value](const Item& item) { return item.value_ == value; });
-
-        if (it == items_.end()) {
+        if (!FindItem(value)) {
             return false; // Value not found
         }
 
@@ -84,34 +178,21 @@ namespace my_reflect::dynamic_refl {
     }
 
     std::optional<std::string> Enum::GetName(const Any& any) const {
-        if (any.typeInfo->GetKind() != Type::Kind::Enum) {
-            throw std::bad_cast();
-        }
-
-        const void* ptr = any.payload;
-        if (ptr) {
-            // Read the value based on the underlying type size
-            long long value = 0;
-            switch (underlyingSize_) {
-                case 1: value = *static_cast<const uint8_t*>(ptr); break;
-                case 2: value = *static_cast<const uint16_t*>(ptr); break;
-                case 4: value = *static_cast<const uint32_t*>(ptr); break;
-                case 8: value = *static_cast<const uint64_t*>(ptr); break;
-                default: return std::nullopt;
-            }
-
-            // Find the name for this value
-            auto it = std::find_if(items_.begin(), items_.end(),
-                [value](const Item& item) { return item.value_ == value; });
-
-            if (it != items_.end()) {
-                return it->name_;
-            }
+        // GetValue checks that any holds an enum
+        std::optional<long long> value = GetValue(any);
+        const Item* item = value ? FindItem(*value) : nullptr;
+        if (item) {
+            return item->name_;
         }
-
         return std::nullopt;
     }
 
+    std::string_view Enum::GetNameView(const Any& any) const {
+        std::optional<long long> value = GetValue(any);
+        const Item* item = value ? FindItem(*value) : nullptr;
+        return item ? std::string_view(item->name_) : std::string_view{};
+    }
+
     std::optional<long long> Enum::GetValue(const Any& any) const {
         if (any.typeInfo->GetKind() != Type::Kind::Enum) {
             throw std::bad_cast();
@@ -13,7 +13,7 @@ namespace my_reflect::dynamic_refl {
 
     MemberContainer::MemberContainer(MemberContainer&& other) noexcept
         : name_(std::move(other.name_)), valueType_(other.valueType_), keyType_(other.keyType_),
-          kind_(other.kind_), ops_(std::move(other.ops_))
+          kind_(other.kind_), ops_(std::move(other.ops_)), accessor_(other.accessor_)
     {
         other.valueType_ = nullptr;
         other.keyType_ = nullptr;
@@ -4,27 +4,159 @@
 
 #include "../../include/dynamic_refl/MemberFunction.h"
 #include "../../include/dynamic_refl/Any.h"
+#include "../../include/dynamic_refl/ThreadPool.h"
+#include <array>
+#include <string>
 
 namespace my_reflect::dynamic_refl {
 
+    namespace {
+        // The argument checks shared by CallPlan and InvokeBatch. argTypeAt(i) is the type of
+        // argument i; context prefixes every error message.
+        template <typename ArgTypeAt>
+        void CheckArguments(const MemberFunction& function, const std::string& context, size_t argCount,
+                            ArgTypeAt argTypeAt) {
+            if (!function.uncheckedInvoker_ || !function.classType_) {
+                throw std::runtime_error(context + ": the function has no typed invoker");
+            }
+            if (argCount != function.argTypes_.size()) {
+                throw std::runtime_error(context + ": expected " + std::to_string(function.argTypes_.size()) +
+                                         " arguments, got " + std::to_string(argCount));
+            }
+            for (size_t i = 0; i < argCount; ++i) {
+                const Type* argType = argTypeAt(i);
+                if (argType != function.argTypes_[i]) {
+                    throw std::runtime_error(context + ": argument " + std::to_string(i) + " has type '" +
+                                             (argType ? argType->GetName() : std::string("null")) +
+                                             "', expected '" + function.argTypes_[i]->GetName() + "'");
+                }
+            }
+        }
+    }
+
     MemberFunction::MemberFunction(std::string name, const Type* retType, std::vector<const Type*> argTypes,
-                                  std::function<Any(Any&, const std::vector<Any>&)> invoker)
-        : name_(std::move(name)), retType_(retType), argTypes_(std::move(argTypes)), invoker_(std::move(invoker))
+                                  Thunk<Any(Any&, ArgSpan)> invoker, const Type* classType,
+                                  UncheckedInvoker uncheckedInvoker, bool isConst)
+        : name_(std::move(name)), retType_(retType), argTypes_(std::move(argTypes)), classType_(classType),
+          isConst_(isConst), invoker_(invoker), uncheckedInvoker_(uncheckedInvoker)
     {
     }
 
     MemberFunction::MemberFunction(MemberFunction&& other) noexcept
         : name_(std::move(other.name_)), retType_(other.retType_), argTypes_(std::move(other.argTypes_)),
-          invoker_(std::move(other.invoker_))
+          classType_(other.classType_), isConst_(other.isConst_), invoker_(other.invoker_),
+          uncheckedInvoker_(other.uncheckedInvoker_)
     {
         other.retType_ = nullptr;
+        other.classType_ = nullptr;
     }
 
     Any MemberFunction::Invoke(Any& instance, const std::vector<Any>& args) const {
+        // Views for the common small arity live on the stack
+        constexpr size_t kInlineArgs = 8;
+        if (args.size() <= kInlineArgs) {
+            std::array<AnyView, kInlineArgs> views;
+            for (size_t i = 0; i < args.size(); ++i) {
+                views[i] = AnyView(args[i]);
+            }
+            return Invoke(instance, ArgSpan(views.data(), args.size()));
+        }
+
+        std::vector<AnyView> views(args.begin(), args.end());
+        return Invoke(instance, ArgSpan(views.data(), views.size()));
+    }
+
+    Any MemberFunction::Invoke(Any& instance, ArgSpan args) const {
         if (!invoker_) {
             throw std::runtime_error("Function invoker is not set");
         }
+        if (std::string error = InstanceError(instance); !error.empty()) {
+            throw std::runtime_error("Invoke '" + name_ + "': instance " + error);
+        }
         return invoker_(instance, args);
     }
 
+    std::string MemberFunction::InstanceError(const Any& instance) const {
+        if (classType_ && instance.typeInfo != classType_) {
+            return "has type '" + (instance.typeInfo ? instance.typeInfo->GetName() : std::string("empty")) +
+                   "', expected '" + classType_->GetName() + "'";
+        }
+        if (!isConst_ && instance.storage() == Any::storage_type::ConstRef) {
+            return "is a const reference and the function is not const";
+        }
+        return {};
+    }
+
+    void MemberFunction::InvokeBatch(Any* instances, size_t count, ArgSpan args, Any* results,
+                                     const BatchOptions& options) const {
+        // Argument types and arity are the same for every call: check them once, then every
+        // instance, all before any call is made or any work reaches the pool
+        CheckArguments(*this, "InvokeBatch '" + name_ + "'", args.size(),
+                       [&](size_t i) { return args[i].typeInfo; });
+        for (size_t i = 0; i < count; ++i) {
+            if (std::string error = InstanceError(instances[i]); !error.empty()) {
+                throw std::runtime_error("InvokeBatch '" + name_ + "': instance " + std::to_string(i) + " " + error);
+            }
+        }
+
+        // Handed to the pool by address: no std::function, so nothing is allocated per batch
+        struct Batch {
+            const MemberFunction* function;
+            Any* instances;
+            Any* results;
+            const AnyView* args;
+
+            static void Run(void* context, size_t begin, size_t end) {
+                const Batch& batch = *static_cast<const Batch*>(context);
+                const UncheckedInvoker& invoke = batch.function->uncheckedInvoker_;
+                if (batch.results) {
+                    for (size_t i = begin; i < end; ++i) {
+                        batch.results[i] = invoke(batch.instances[i].payload, batch.args);
+                    }
+                } else {
+                    for (size_t i = begin; i < end; ++i) {
+                        invoke(batch.instances[i].payload, batch.args);
+                    }
+                }
+            }
+        };
+        Batch batch{this, instances, results, args.begin()};
+
+        if (options.pool) {
+            options.pool->ParallelFor(count, options.minChunk, &Batch::Run, &batch);
+        } else {
+            Batch::Run(&batch, 0, count);
+        }
+    }
+
+    void MemberFunction::InvokeBatch(std::vector<Any>& instances, ArgSpan args, std::vector<Any>* results,
+                                     const BatchOptions& options) const {
+        if (results) {
+            results->resize(instances.size());
+        }
+        InvokeBatch(instances.data(), instances.size(), args, results ? results->data() : nullptr, options);
+    }
+
+    // ========== CallPlan ==========
+
+    CallPlan::CallPlan(const MemberFunction& function, const Type* instanceType, std::vector<const Type*> argTypes)
+        : function_(&function) {
+        const std::string context = "Call plan for '" + function.name_ + "'";
+        CheckArguments(function, context, argTypes.size(), [&](size_t i) { return argTypes[i]; });
+        if (instanceType != function.classType_) {
+            throw std::runtime_error(context + ": instance type '" +
+                                     (instanceType ? instanceType->GetName() : std::string("null")) +
+                                     "' does not match '" + function.classType_->GetName() + "'");
+        }
+    }
+
+    bool CallPlan::ArgumentsMatch(ArgSpan args) const {
+        for (size_t i = 0; i < args.size(); ++i) {
+            if (args[i].typeInfo != function_->argTypes_[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
 }
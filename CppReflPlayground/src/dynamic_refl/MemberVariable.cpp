@@ -6,13 +6,13 @@
 
 namespace my_reflect::dynamic_refl {
 
-    MemberVariable::MemberVariable(std::string name, const Type* type)
-        : name_(std::move(name)), type_(type)
+    MemberVariable::MemberVariable(std::string name, const Type* type, MemberAccessor accessor)
+        : name_(std::move(name)), type_(type), accessor_(accessor)
     {
     }
 
     MemberVariable::MemberVariable(MemberVariable&& other) noexcept
-        : name_(std::move(other.name_)), type_(other.type_)
+        : name_(std::move(other.name_)), type_(other.type_), accessor_(other.accessor_)
     {
         other.type_ = nullptr;
     }
@@ -0,0 +1,72 @@
+//
+// Created by qianq on 1/4/2026.
+//
+
+#include "../../include/dynamic_refl/NameIndex.h"
+#include "../../include/dynamic_refl/dynamic_refl_util.h"
+
+namespace my_reflect::dynamic_refl {
+
+    void NameIndex::Insert(std::string_view name, Kind kind, uint32_t index) {
+        ++counts_[static_cast<size_t>(kind)];
+        if (Find(name, kind) != npos) {
+            return; // Keep the first registration, like a linear scan would
+        }
+        if ((used_ + 1) * 2 > slots_.size()) {
+            Grow();
+        }
+        Place(Slot{Hash(name, kind), std::string(name), index, kind, true});
+        ++used_;
+    }
+
+    int NameIndex::Find(std::string_view name, Kind kind) const {
+        if (slots_.empty()) {
+            return npos;
+        }
+        const uint64_t hash = Hash(name, kind);
+        const size_t mask = slots_.size() - 1;
+        for (size_t i = hash & mask; slots_[i].used; i = (i + 1) & mask) {
+            const Slot& slot = slots_[i];
+            if (slot.hash == hash && slot.kind == kind && slot.name == name) {
+                return static_cast<int>(slot.index);
+            }
+        }
+        return npos;
+    }
+
+    size_t NameIndex::Count(Kind kind) const {
+        return counts_[static_cast<size_t>(kind)];
+    }
+
+    void NameIndex::Clear() {
+        slots_.clear();
+        used_ = 0;
+        counts_[0] = counts_[1] = counts_[2] = counts_[3] = 0;
+    }
+
+    void NameIndex::Grow() {
+        std::vector<Slot> old = std::move(slots_);
+        slots_.clear();
+        slots_.resize(old.empty() ? 16 : old.size() * 2);
+        for (auto& slot : old) {
+            if (slot.used) {
+                Place(std::move(slot));
+            }
+        }
+    }
+
+    void NameIndex::Place(Slot&& slot) {
+        const size_t mask = slots_.size() - 1;
+        size_t i = slot.hash & mask;
+        while (slots_[i].used) {
+            i = (i + 1) & mask;
+        }
+        slots_[i] = std::move(slot);
+    }
+
+    uint64_t NameIndex::Hash(std::string_view name, Kind kind) {
+        // Mix the kind in so a function and a variable with the same name use different chains
+        return utils::HashName(name) ^ (static_cast<uint64_t>(kind) * 0x9E3779B97F4A7C15ull);
+    }
+
+}
@@ -0,0 +1,145 @@
+//
+// Created by qianq on 1/5/2026.
+//
+
+#include "../../include/dynamic_refl/ThreadPool.h"
+#include <algorithm>
+
+namespace my_reflect::dynamic_refl {
+
+    namespace {
+        // Pools running chunks on this thread (as a worker or as the ParallelFor caller), innermost first
+        struct ActiveFrame {
+            const ThreadPool* pool;
+            const ActiveFrame* outer;
+        };
+        thread_local const ActiveFrame* t_activePools = nullptr;
+
+        class ActiveScope {
+        public:
+            explicit ActiveScope(const ThreadPool* pool) : frame_{pool, t_activePools} { t_activePools = &frame_; }
+            ~ActiveScope() { t_activePools = frame_.outer; }
+            ActiveScope(const ActiveScope&) = delete;
+            ActiveScope& operator=(const ActiveScope&) = delete;
+
+        private:
+            ActiveFrame frame_;
+        };
+    }
+
+    ThreadPool::ThreadPool(size_t workerCount) {
+        workers_.reserve(workerCount);
+        for (size_t i = 0; i < workerCount; ++i) {
+            workers_.emplace_back([this] { WorkerLoop(); });
+        }
+    }
+
+    ThreadPool::~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    size_t ThreadPool::DefaultWorkerCount() {
+        unsigned hardware = std::thread::hardware_concurrency();
+        return hardware > 1 ? hardware - 1 : 0;
+    }
+
+    bool ThreadPool::IsRunningOnThisThread() const {
+        for (const ActiveFrame* frame = t_activePools; frame; frame = frame->outer) {
+            if (frame->pool == this) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void ThreadPool::ParallelFor(size_t count, size_t minChunk, RangeFunction body, void* context) {
+        if (count == 0) {
+            return;
+        }
+        minChunk = std::max<size_t>(minChunk, 1);
+        // Nested calls run inline: waiting for submitMutex_ (held by the outer call) would deadlock
+        if (workers_.empty() || count <= minChunk || IsRunningOnThisThread()) {
+            body(context, 0, count);
+            return;
+        }
+
+        std::lock_guard<std::mutex> submit(submitMutex_);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            // About four chunks per thread, so a slow chunk does not hold up the whole batch
+            size_t threads = workers_.size() + 1;
+            body_ = body;
+            context_ = context;
+            count_ = count;
+            chunk_ = std::max(minChunk, (count + threads * 4 - 1) / (threads * 4));
+            next_.store(0, std::memory_order_relaxed);
+            error_ = nullptr;
+            busyWorkers_ = workers_.size();
+            ++generation_;
+        }
+        wake_.notify_all();
+
+        {
+            ActiveScope active(this);
+            RunChunks();
+        }
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_.wait(lock, [this] { return busyWorkers_ == 0; });
+        body_ = nullptr;
+        context_ = nullptr;
+        if (error_) {
+            std::exception_ptr error = error_;
+            error_ = nullptr;
+            std::rethrow_exception(error);
+        }
+    }
+
+    void ThreadPool::RunChunks() {
+        for (;;) {
+            size_t begin = next_.fetch_add(chunk_, std::memory_order_relaxed);
+            if (begin >= count_) {
+                return;
+            }
+            try {
+                body_(context_, begin, std::min(begin + chunk_, count_));
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (!error_) {
+                    error_ = std::current_exception();
+                }
+                next_.store(count_, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void ThreadPool::WorkerLoop() {
+        ActiveScope active(this);
+        uint64_t seen = 0;
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wake_.wait(lock, [&] { return stop_ || generation_ != seen; });
+                if (stop_) {
+                    return;
+                }
+                seen = generation_;
+            }
+
+            RunChunks();
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (--busyWorkers_ == 0) {
+                done_.notify_one();
+            }
+        }
+    }
+
+}
@@ -6,13 +6,22 @@
 #include "../../include/dynamic_refl/Arithmetic.h"
 #include "../../include/dynamic_refl/Enum.h"
 #include "../../include/dynamic_refl/Class.h"
+#include <atomic>
 
 namespace my_reflect::dynamic_refl {
 
-    Type::Type(const std::string& name, Kind kind) : name_(name), kind_(kind) {}
+    namespace {
+        TypeId NextTypeId() {
+            static std::atomic<TypeId> nextId{1};
+            return nextId.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    Type::Type(const std::string& name, Kind kind) : name_(name), kind_(kind), id_(NextTypeId()) {}
 
+    // A moved-to Type keeps the id, so factories that move their info in stay dense
     Type::Type(Type&& other) noexcept
-        : name_(std::move(other.name_)), kind_(other.kind_) {}
+        : name_(std::move(other.name_)), kind_(other.kind_), id_(other.id_) {}
 
     const Arithmetic* Type::AsArithmetic() const {
         return kind_ == Kind::Arithmetic ? static_cast<const Arithmetic*>(this) : nullptr;
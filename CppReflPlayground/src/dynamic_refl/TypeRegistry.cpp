@@ -3,28 +3,113 @@
 //
 
 #include "../../include/dynamic_refl/TypeRegistry.h"
+#include "../../include/dynamic_refl/dynamic_refl_util.h"
 
 namespace my_reflect::dynamic_refl {
 
+    TypeRegistry::Table::Table(size_t capacity)
+        : capacity(capacity), slots(new std::atomic<Entry*>[capacity]) {
+        for (size_t i = 0; i < capacity; ++i) {
+            slots[i].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    TypeRegistry::TypeRegistry() {
+        tables_.push_back(std::make_unique<Table>(64));
+        table_.store(tables_.back().get(), std::memory_order_release);
+    }
+
+    TypeRegistry::~TypeRegistry() = default;
+
     TypeRegistry& TypeRegistry::Instance() {
         static TypeRegistry instance;
         return instance;
     }
 
-    void TypeRegistry::RegisterType(const std::string& name, Type* type) {
-        if (types_.find(name) != types_.end()) {
+    void TypeRegistry::RegisterType(std::string_view name, Type* type) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Entry* entry = FindOrInsert(name, utils::HashName(name));
+        if (entry->type.load(std::memory_order_relaxed) != nullptr) {
             return; // Already registered
         }
-        types_[name] = type;
+        entry->type.store(type, std::memory_order_release);
+    }
+
+    Type* TypeRegistry::GetTypeByName(std::string_view name) const {
+        return GetTypeByName(InternedName{name, utils::HashName(name)});
+    }
+
+    Type* TypeRegistry::GetTypeByName(const InternedName& name) const {
+        const Table* table = table_.load(std::memory_order_acquire);
+        const Entry* entry = Find(*table, name.name, name.hash);
+        return entry ? entry->type.load(std::memory_order_acquire) : nullptr;
+    }
+
+    InternedName TypeRegistry::Intern(std::string_view name) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return FindOrInsert(name, utils::HashName(name))->key;
+    }
+
+    std::unordered_map<std::string, Type*> TypeRegistry::GetAllTypes() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::unordered_map<std::string, Type*> types;
+        for (const auto& entry : entries_) {
+            if (Type* type = entry.type.load(std::memory_order_relaxed)) {
+                types.emplace(entry.key.name, type);
+            }
+        }
+        return types;
     }
 
-    Type* TypeRegistry::GetTypeByName(const std::string& name) const {
-        auto it = types_.find(name);
-        return it != types_.end() ? it->second : nullptr;
+    TypeRegistry::Entry* TypeRegistry::Find(const Table& table, std::string_view name, uint64_t hash) const {
+        const size_t mask = table.capacity - 1;
+        for (size_t i = hash & mask;; i = (i + 1) & mask) {
+            Entry* entry = table.slots[i].load(std::memory_order_acquire);
+            if (entry == nullptr) {
+                return nullptr;
+            }
+            // Interned views can match by pointer before falling back to a compare
+            if (entry->key.hash == hash &&
+                (entry->key.name.data() == name.data() || entry->key.name == name)) {
+                return entry;
+            }
+        }
     }
 
-    const std::unordered_map<std::string, Type*>& TypeRegistry::GetAllTypes() const {
-        return types_;
+    TypeRegistry::Entry* TypeRegistry::FindOrInsert(std::string_view name, uint64_t hash) {
+        Table* table = table_.load(std::memory_order_relaxed);
+        if (Entry* entry = Find(*table, name, hash)) {
+            return entry;
+        }
+
+        if ((count_ + 1) * 2 > table->capacity) {
+            // Build a larger table and publish it; readers still holding the old one stay valid
+            auto grown = std::make_unique<Table>(table->capacity * 2);
+            const size_t mask = grown->capacity - 1;
+            for (auto& entry : entries_) {
+                size_t i = entry.key.hash & mask;
+                while (grown->slots[i].load(std::memory_order_relaxed) != nullptr) {
+                    i = (i + 1) & mask;
+                }
+                grown->slots[i].store(&entry, std::memory_order_relaxed);
+            }
+            table = grown.get();
+            tables_.push_back(std::move(grown));
+            table_.store(table, std::memory_order_release);
+        }
+
+        names_.emplace_back(name);
+        Entry& entry = entries_.emplace_back();
+        entry.key = InternedName{names_.back(), hash};
+
+        const size_t mask = table->capacity - 1;
+        size_t i = hash & mask;
+        while (table->slots[i].load(std::memory_order_relaxed) != nullptr) {
+            i = (i + 1) & mask;
+        }
+        table->slots[i].store(&entry, std::memory_order_release);
+        ++count_;
+        return &entry;
     }
 
 }
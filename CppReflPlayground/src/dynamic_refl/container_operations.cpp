@@ -36,9 +36,19 @@ namespace container_ops {
         return containerInfo.ops_.push(container, value);
     }
 
+    bool PushMove(const MemberContainer& containerInfo, Any& container, Any&& value) {
+        if (container.storage() == Any::storage_type::ConstRef) {
+            throw std::runtime_error("Cannot modify const reference Any");
+        }
+        if (!containerInfo.ops_.push_move) {
+            throw std::runtime_error("Container does not support push/insert operation");
+        }
+        return containerInfo.ops_.push_move(container, value);
+    }
+
     Any At(const MemberContainer& containerInfo, const Any& container, size_t index) {
         if (!containerInfo.ops_.at) {
-            throw std::runtime_error("Container does not support at() operation (only for vectors)");
+            throw std::runtime_error("Container does not support at() operation (only for vectors, deques and arrays)");
         }
         return containerInfo.ops_.at(container, index);
     }
@@ -53,6 +63,26 @@ namespace container_ops {
         return containerInfo.ops_.insert_kv(map, key, value);
     }
 
+    bool EmplaceKV(const MemberContainer& containerInfo, Any& map, Any&& key, Any&& value) {
+        if (map.storage() == Any::storage_type::ConstRef) {
+            throw std::runtime_error("Cannot modify const reference Any");
+        }
+        if (!containerInfo.ops_.emplace_kv) {
+            throw std::runtime_error("Container does not support emplace key-value operation (only for maps)");
+        }
+        return containerInfo.ops_.emplace_kv(map, key, value);
+    }
+
+    bool TryEmplace(const MemberContainer& containerInfo, Any& map, Any&& key, Any&& value) {
+        if (map.storage() == Any::storage_type::ConstRef) {
+            throw std::runtime_error("Cannot modify const reference Any");
+        }
+        if (!containerInfo.ops_.try_emplace) {
+            throw std::runtime_error("Container does not support try_emplace operation (only for maps)");
+        }
+        return containerInfo.ops_.try_emplace(map, key, value);
+    }
+
     Any GetValue(const MemberContainer& containerInfo, const Any& map, const Any& key) {
         if (!containerInfo.ops_.get_value) {
             throw std::runtime_error("Container does not support get value operation (only for maps)");
@@ -62,11 +92,69 @@ namespace container_ops {
 
     bool ContainsKey(const MemberContainer& containerInfo, const Any& map, const Any& key) {
         if (!containerInfo.ops_.contains_key) {
-            throw std::runtime_error("Container does not support contains key operation (only for maps)");
+            throw std::runtime_error("Container does not support contains key operation (only for maps and sets)");
         }
         return containerInfo.ops_.contains_key(map, key);
     }
 
+    ContiguousBlock Contiguous(const MemberContainer& containerInfo, const Any& container) {
+        if (!containerInfo.ops_.contiguous) {
+            throw std::runtime_error("Container does not support contiguous access (only vectors and arrays of trivially copyable elements)");
+        }
+        return containerInfo.ops_.contiguous(container);
+    }
+
+    void Reserve(const MemberContainer& containerInfo, Any& container, size_t capacity) {
+        if (container.storage() == Any::storage_type::ConstRef) {
+            throw std::runtime_error("Cannot modify const reference Any");
+        }
+        if (!containerInfo.ops_.reserve) {
+            throw std::runtime_error("Container does not support reserve() operation (only for vectors)");
+        }
+        containerInfo.ops_.reserve(container, capacity);
+    }
+
+    void Resize(const MemberContainer& containerInfo, Any& container, size_t size) {
+        if (container.storage() == Any::storage_type::ConstRef) {
+            throw std::runtime_error("Cannot modify const reference Any");
+        }
+        if (!containerInfo.ops_.resize) {
+            throw std::runtime_error("Container does not support resize() operation (only for vectors and deques)");
+        }
+        containerInfo.ops_.resize(container, size);
+    }
+
+    bool AssignRange(const MemberContainer& containerInfo, Any& container,
+                     const void* data, size_t count, const Type* elementType) {
+        if (container.storage() == Any::storage_type::ConstRef) {
+            throw std::runtime_error("Cannot modify const reference Any");
+        }
+        if (!containerInfo.ops_.assign_range) {
+            throw std::runtime_error("Container does not support assign_range operation (only for vectors and deques)");
+        }
+        return containerInfo.ops_.assign_range(container, data, count, elementType);
+    }
+
+    bool AppendRange(const MemberContainer& containerInfo, Any& container,
+                     const void* data, size_t count, const Type* elementType) {
+        if (container.storage() == Any::storage_type::ConstRef) {
+            throw std::runtime_error("Cannot modify const reference Any");
+        }
+        if (!containerInfo.ops_.append_range) {
+            throw std::runtime_error("Container does not support append_range operation (only for vectors and deques)");
+        }
+        return containerInfo.ops_.append_range(container, data, count, elementType);
+    }
+
+    ContainerCursor Begin(const MemberContainer& containerInfo, const Any& container) {
+        if (!containerInfo.ops_.begin) {
+            throw std::runtime_error("Container does not support cursor iteration");
+        }
+        ContainerCursor cursor;
+        containerInfo.ops_.begin(container, cursor);
+        return cursor;
+    }
+
 } // namespace container_ops
 
 } // namespace my_reflect::dynamic_refl
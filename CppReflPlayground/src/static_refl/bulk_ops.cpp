@@ -0,0 +1,355 @@
+//
+// Created by qianq on 1/5/2026.
+//
+
+#include "../../include/static_refl/bulk_ops.h"
+#include <atomic>
+#include <climits>
+#include <cmath>
+#include <cstring>
+#include <type_traits>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define MY_REFLECT_BULK_AVX2 1
+#include <immintrin.h>
+#else
+#define MY_REFLECT_BULK_AVX2 0
+#endif
+
+namespace my_reflect::static_refl::utils {
+
+    namespace {
+        enum class Op { Sum, Min, Max };
+
+        simd_level Detect() {
+#if MY_REFLECT_BULK_AVX2
+            if (__builtin_cpu_supports("avx2")) {
+                return simd_level::AVX2;
+            }
+#endif
+            return simd_level::Scalar;
+        }
+
+        std::atomic<simd_level>& ActiveLevel() {
+            static std::atomic<simd_level> level{detected_simd_level()};
+            return level;
+        }
+
+        template <typename V>
+        V LoadAt(const std::byte* p) {
+            V value;
+            std::memcpy(&value, p, sizeof(V));
+            return value;
+        }
+
+        // Min and max keep the accumulator a when b is NaN, so NaN values are skipped as long as
+        // the accumulator starts from a non-NaN value (see StartOfOrdered). The AVX2 kernels call
+        // min/max with the new values first, which gives the same rule.
+        template <Op op, typename L>
+        L CombineScalar(L a, L b) {
+            if constexpr (op == Op::Sum) {
+                return a + b;
+            } else if constexpr (op == Op::Min) {
+                return b < a ? b : a;
+            } else {
+                return a < b ? b : a;
+            }
+        }
+
+        template <Op op, typename Value, typename Lane>
+        Lane ReduceScalarStrided(const std::byte* p, size_t count, size_t stride, Lane init) {
+            Lane acc0 = init, acc1 = init, acc2 = init, acc3 = init;
+            size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                acc0 = CombineScalar<op>(acc0, static_cast<Lane>(LoadAt<Value>(p + i * stride)));
+                acc1 = CombineScalar<op>(acc1, static_cast<Lane>(LoadAt<Value>(p + (i + 1) * stride)));
+                acc2 = CombineScalar<op>(acc2, static_cast<Lane>(LoadAt<Value>(p + (i + 2) * stride)));
+                acc3 = CombineScalar<op>(acc3, static_cast<Lane>(LoadAt<Value>(p + (i + 3) * stride)));
+            }
+            Lane result = CombineScalar<op>(CombineScalar<op>(acc0, acc1), CombineScalar<op>(acc2, acc3));
+            for (; i < count; ++i) {
+                result = CombineScalar<op>(result, static_cast<Lane>(LoadAt<Value>(p + i * stride)));
+            }
+            return result;
+        }
+
+        // Four independent accumulators instead of one dependency chain; with a constant stride
+        // the compiler turns them into its baseline vector code (SSE2 on x86-64)
+        template <Op op, typename Value, typename Lane>
+        Lane ReduceScalar(const std::byte* p, size_t count, size_t stride, Lane init) {
+            if (stride == sizeof(Value)) {
+                return ReduceScalarStrided<op, Value, Lane>(p, count, sizeof(Value), init);
+            }
+            return ReduceScalarStrided<op, Value, Lane>(p, count, stride, init);
+        }
+
+#if MY_REFLECT_BULK_AVX2
+#define BULK_AVX2 __attribute__((target("avx2")))
+
+        // One "shape" per way of turning memory into a vector of lanes.
+        // Gathers take byte offsets (scale 1) from the first element of the block.
+
+        struct F64x4 {
+            using Value = double;
+            using Lane = double;
+            using Vec = __m256d;
+            static constexpr size_t lanes = 4;
+
+            BULK_AVX2 static __m256i MakeIndex(size_t stride) {
+                auto s = static_cast<long long>(stride);
+                return _mm256_setr_epi64x(0, s, 2 * s, 3 * s);
+            }
+            BULK_AVX2 static Vec Load(const std::byte* p) { return _mm256_loadu_pd(reinterpret_cast<const double*>(p)); }
+            BULK_AVX2 static Vec Gather(const std::byte* p, __m256i index) {
+                return _mm256_i64gather_pd(reinterpret_cast<const double*>(p), index, 1);
+            }
+            BULK_AVX2 static Vec Set1(Lane value) { return _mm256_set1_pd(value); }
+            BULK_AVX2 static void Store(Lane* out, Vec v) { _mm256_storeu_pd(out, v); }
+            BULK_AVX2 static Vec Add(Vec a, Vec b) { return _mm256_add_pd(a, b); }
+            BULK_AVX2 static Vec Min(Vec a, Vec b) { return _mm256_min_pd(a, b); }
+            BULK_AVX2 static Vec Max(Vec a, Vec b) { return _mm256_max_pd(a, b); }
+        };
+
+        struct F32x8 {
+            using Value = float;
+            using Lane = float;
+            using Vec = __m256;
+            static constexpr size_t lanes = 8;
+
+            BULK_AVX2 static __m256i MakeIndex(size_t stride) {
+                auto s = static_cast<int>(stride);
+                return _mm256_setr_epi32(0, s, 2 * s, 3 * s, 4 * s, 5 * s, 6 * s, 7 * s);
+            }
+            BULK_AVX2 static Vec Load(const std::byte* p) { return _mm256_loadu_ps(reinterpret_cast<const float*>(p)); }
+            BULK_AVX2 static Vec Gather(const std::byte* p, __m256i index) {
+                return _mm256_i32gather_ps(reinterpret_cast<const float*>(p), index, 1);
+            }
+            BULK_AVX2 static Vec Set1(Lane value) { return _mm256_set1_ps(value); }
+            BULK_AVX2 static void Store(Lane* out, Vec v) { _mm256_storeu_ps(out, v); }
+            BULK_AVX2 static Vec Add(Vec a, Vec b) { return _mm256_add_ps(a, b); }
+            BULK_AVX2 static Vec Min(Vec a, Vec b) { return _mm256_min_ps(a, b); }
+            BULK_AVX2 static Vec Max(Vec a, Vec b) { return _mm256_max_ps(a, b); }
+        };
+
+        struct I32x8 {
+            using Value = int32_t;
+            using Lane = int32_t;
+            using Vec = __m256i;
+            static constexpr size_t lanes = 8;
+
+            BULK_AVX2 static __m256i MakeIndex(size_t stride) { return F32x8::MakeIndex(stride); }
+            BULK_AVX2 static Vec Load(const std::byte* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+            BULK_AVX2 static Vec Gather(const std::byte* p, __m256i index) {
+                return _mm256_i32gather_epi32(reinterpret_cast<const int*>(p), index, 1);
+            }
+            BULK_AVX2 static Vec Set1(Lane value) { return _mm256_set1_epi32(value); }
+            BULK_AVX2 static void Store(Lane* out, Vec v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), v); }
+            BULK_AVX2 static Vec Min(Vec a, Vec b) { return _mm256_min_epi32(a, b); }
+            BULK_AVX2 static Vec Max(Vec a, Vec b) { return _mm256_max_epi32(a, b); }
+        };
+
+        // int32 widened to int64 lanes so sums do not overflow
+        struct I32to64x4 {
+            using Value = int32_t;
+            using Lane = int64_t;
+            using Vec = __m256i;
+            static constexpr size_t lanes = 4;
+
+            BULK_AVX2 static __m128i MakeIndex(size_t stride) {
+                auto s = static_cast<int>(stride);
+                return _mm_setr_epi32(0, s, 2 * s, 3 * s);
+            }
+            BULK_AVX2 static Vec Load(const std::byte* p) {
+                return _mm256_cvtepi32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+            }
+            BULK_AVX2 static Vec Gather(const std::byte* p, __m128i index) {
+                return _mm256_cvtepi32_epi64(_mm_i32gather_epi32(reinterpret_cast<const int*>(p), index, 1));
+            }
+            BULK_AVX2 static Vec Set1(Lane value) { return _mm256_set1_epi64x(value); }
+            BULK_AVX2 static void Store(Lane* out, Vec v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), v); }
+            BULK_AVX2 static Vec Add(Vec a, Vec b) { return _mm256_add_epi64(a, b); }
+        };
+
+        struct I64x4 {
+            using Value = int64_t;
+            using Lane = int64_t;
+            using Vec = __m256i;
+            static constexpr size_t lanes = 4;
+
+            BULK_AVX2 static __m256i MakeIndex(size_t stride) { return F64x4::MakeIndex(stride); }
+            BULK_AVX2 static Vec Load(const std::byte* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+            BULK_AVX2 static Vec Gather(const std::byte* p, __m256i index) {
+                return _mm256_i64gather_epi64(reinterpret_cast<const long long*>(p), index, 1);
+            }
+            BULK_AVX2 static Vec Set1(Lane value) { return _mm256_set1_epi64x(value); }
+            BULK_AVX2 static void Store(Lane* out, Vec v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), v); }
+            BULK_AVX2 static Vec Add(Vec a, Vec b) { return _mm256_add_epi64(a, b); }
+            // No 64-bit min/max before AVX-512: compare and blend
+            BULK_AVX2 static Vec Min(Vec a, Vec b) { return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(a, b)); }
+            BULK_AVX2 static Vec Max(Vec a, Vec b) { return _mm256_blendv_epi8(b, a, _mm256_cmpgt_epi64(a, b)); }
+        };
+
+        template <Op op, typename Value>
+        struct Avx2Shape;
+
+        template <Op op> struct Avx2Shape<op, double> { using type = F64x4; };
+        template <Op op> struct Avx2Shape<op, float> { using type = F32x8; };
+        template <Op op> struct Avx2Shape<op, int32_t> { using type = I32x8; };
+        template <> struct Avx2Shape<Op::Sum, int32_t> { using type = I32to64x4; };
+        template <Op op> struct Avx2Shape<op, int64_t> { using type = I64x4; };
+
+        // b holds the new values: min/max return their second operand when either is NaN
+        template <Op op, typename Shape>
+        BULK_AVX2 typename Shape::Vec Combine(typename Shape::Vec a, typename Shape::Vec b) {
+            if constexpr (op == Op::Sum) {
+                return Shape::Add(a, b);
+            } else if constexpr (op == Op::Min) {
+                return Shape::Min(b, a);
+            } else {
+                return Shape::Max(b, a);
+            }
+        }
+
+        // Two accumulators per call to hide the latency of the combine
+        template <Op op, typename Shape>
+        BULK_AVX2 typename Shape::Lane ReduceAvx2(const std::byte* p, size_t count, size_t stride,
+                                                  typename Shape::Lane init) {
+            using Lane = typename Shape::Lane;
+            using Value = typename Shape::Value;
+            constexpr size_t lanes = Shape::lanes;
+
+            auto acc0 = Shape::Set1(init);
+            auto acc1 = acc0;
+            size_t i = 0;
+            if (stride == sizeof(Value)) {
+                for (; i + 2 * lanes <= count; i += 2 * lanes) {
+                    acc0 = Combine<op, Shape>(acc0, Shape::Load(p + i * stride));
+                    acc1 = Combine<op, Shape>(acc1, Shape::Load(p + (i + lanes) * stride));
+                }
+            } else if (stride * lanes <= static_cast<size_t>(INT_MAX)) {
+                auto index = Shape::MakeIndex(stride);
+                for (; i + 2 * lanes <= count; i += 2 * lanes) {
+                    acc0 = Combine<op, Shape>(acc0, Shape::Gather(p + i * stride, index));
+                    acc1 = Combine<op, Shape>(acc1, Shape::Gather(p + (i + lanes) * stride, index));
+                }
+            }
+
+            Lane parts[lanes];
+            Shape::Store(parts, Combine<op, Shape>(acc0, acc1));
+            Lane result = init;
+            for (size_t k = 0; k < lanes; ++k) {
+                result = CombineScalar<op>(result, parts[k]);
+            }
+            for (; i < count; ++i) {
+                result = CombineScalar<op>(result, static_cast<Lane>(LoadAt<Value>(p + i * stride)));
+            }
+            return result;
+        }
+#endif
+
+        // init is 0 for sums and the first element for min/max
+        template <Op op, typename Value, typename Lane>
+        Lane Reduce(const std::byte* p, size_t count, size_t stride, Lane init) {
+#if MY_REFLECT_BULK_AVX2
+            if (ActiveLevel().load(std::memory_order_relaxed) == simd_level::AVX2) {
+                return ReduceAvx2<op, typename Avx2Shape<op, Value>::type>(p, count, stride, init);
+            }
+#endif
+            return ReduceScalar<op, Value, Lane>(p, count, stride, init);
+        }
+
+        // Index of the first value that is not NaN, or count if there is none
+        template <typename Value>
+        size_t StartOfOrdered(const std::byte* p, size_t count, size_t stride) {
+            size_t i = 0;
+            if constexpr (std::is_floating_point_v<Value>) {
+                while (i < count && std::isnan(LoadAt<Value>(p + i * stride))) {
+                    ++i;
+                }
+            }
+            return i;
+        }
+
+        // Min and max skip NaN values and return NaN only when every value is NaN
+        template <Op op, typename Value>
+        Value MinMax(const std::byte* p, size_t count, size_t stride) {
+            size_t start = StartOfOrdered<Value>(p, count, stride);
+            if (start == count) {
+                return LoadAt<Value>(p);
+            }
+            const std::byte* first = p + start * stride;
+            return Reduce<op, Value, Value>(first, count - start, stride, LoadAt<Value>(first));
+        }
+    }
+
+    // ========== Level Selection ==========
+
+    simd_level detected_simd_level() {
+        static const simd_level level = Detect();
+        return level;
+    }
+
+    simd_level active_simd_level() {
+        return ActiveLevel().load(std::memory_order_relaxed);
+    }
+
+    void set_simd_level(simd_level level) {
+        if (level > detected_simd_level()) {
+            level = detected_simd_level();
+        }
+        ActiveLevel().store(level, std::memory_order_relaxed);
+    }
+
+    // ========== Kernels ==========
+
+    namespace detail {
+        double bulk_sum_f64(const std::byte* first, size_t count, size_t stride) {
+            return Reduce<Op::Sum, double, double>(first, count, stride, 0.0);
+        }
+
+        float bulk_sum_f32(const std::byte* first, size_t count, size_t stride) {
+            return Reduce<Op::Sum, float, float>(first, count, stride, 0.0f);
+        }
+
+        int64_t bulk_sum_i32(const std::byte* first, size_t count, size_t stride) {
+            return Reduce<Op::Sum, int32_t, int64_t>(first, count, stride, 0);
+        }
+
+        int64_t bulk_sum_i64(const std::byte* first, size_t count, size_t stride) {
+            return Reduce<Op::Sum, int64_t, int64_t>(first, count, stride, 0);
+        }
+
+        double bulk_min_f64(const std::byte* first, size_t count, size_t stride) {
+            return MinMax<Op::Min, double>(first, count, stride);
+        }
+
+        float bulk_min_f32(const std::byte* first, size_t count, size_t stride) {
+            return MinMax<Op::Min, float>(first, count, stride);
+        }
+
+        int32_t bulk_min_i32(const std::byte* first, size_t count, size_t stride) {
+            return MinMax<Op::Min, int32_t>(first, count, stride);
+        }
+
+        int64_t bulk_min_i64(const std::byte* first, size_t count, size_t stride) {
+            return MinMax<Op::Min, int64_t>(first, count, stride);
+        }
+
+        double bulk_max_f64(const std::byte* first, size_t count, size_t stride) {
+            return MinMax<Op::Max, double>(first, count, stride);
+        }
+
+        float bulk_max_f32(const std::byte* first, size_t count, size_t stride) {
+            return MinMax<Op::Max, float>(first, count, stride);
+        }
+
+        int32_t bulk_max_i32(const std::byte* first, size_t count, size_t stride) {
+            return MinMax<Op::Max, int32_t>(first, count, stride);
+        }
+
+        int64_t bulk_max_i64(const std::byte* first, size_t count, size_t stride) {
+            return MinMax<Op::Max, int64_t>(first, count, stride);
+        }
+    }
+
+}
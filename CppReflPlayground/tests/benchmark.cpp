@@ -0,0 +1,928 @@
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <new>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "../include/dynamic_refl/dynamic_reflect_core.h"
+#include "../include/dynamic_refl/Any.h"
+#include "../include/dynamic_refl/AnyArena.h"
+#include "../include/dynamic_refl/ThreadPool.h"
+#include "../include/dynamic_refl/container_operations.h"
+#include "../include/static_refl/binary_serializer.h"
+#include "../include/static_refl/json_serializer.h"
+#include "../include/static_refl/soa_vector.h"
+#include "../include/static_refl/bulk_ops.h"
+
+// ========== Allocation counting ==========
+
+static size_t g_allocations = 0;
+
+// Kept out of line: once inlined, GCC pairs the malloc in operator new with the free in
+// operator delete and reports them as mismatched (-Wmismatched-new-delete)
+[[gnu::noinline]] void* operator new(std::size_t size) {
+	++g_allocations;
+	if (void* p = std::malloc(size ? size : 1)) {
+		return p;
+	}
+	throw std::bad_alloc();
+}
+
+[[gnu::noinline]] void operator delete(void* p) noexcept {
+	std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+	operator delete(p);
+}
+
+// Runs body `iterations` times and reports time and heap allocations
+template <typename Body>
+void run_benchmark(const std::string& name, size_t iterations, Body&& body) {
+	size_t allocationsBefore = g_allocations;
+	auto start = std::chrono::steady_clock::now();
+	for (size_t i = 0; i < iterations; ++i) {
+		body(i);
+	}
+	auto end = std::chrono::steady_clock::now();
+	size_t allocations = g_allocations - allocationsBefore;
+
+	double ns = std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+	std::cout << "  " << name << ": " << ns << " ns/iter, "
+	          << static_cast<double>(allocations) / iterations << " allocs/iter\n";
+}
+
+// Written by do_not_optimize; volatile, so the stores cannot be dropped
+template <typename T>
+volatile T g_sink{};
+
+// Keeps the optimizer from discarding benchmark results
+template <typename T>
+void do_not_optimize(const T& value) {
+	g_sink<T> = value;
+}
+
+enum class Mode { Idle, Running, Stopped };
+
+// Enumerators are registered at run time by bench_enum_lookup
+enum class StatusCode : int {};
+
+class Counter {
+public:
+	int add(int delta) { value += delta; return value; }
+	int get() const { return value; }
+
+	int value = 0;
+};
+
+BEGIN_REFLECT(Counter)
+functions(
+	func(&Counter::add),
+	func(&Counter::get)
+)
+variables(
+	var(&Counter::value)
+)
+END_REFLECT()
+
+struct Snapshot {
+	int frame = 0;
+	double time = 0.0;
+	Mode mode = Mode::Idle;
+	std::vector<double> positions;
+	std::vector<std::string> labels;
+};
+
+BEGIN_REFLECT(Snapshot)
+variables(
+	var(&Snapshot::frame),
+	var(&Snapshot::time),
+	var(&Snapshot::mode)
+)
+containers(
+	container(&Snapshot::positions),
+	container(&Snapshot::labels)
+)
+END_REFLECT()
+
+struct Particle {
+	double x = 0, y = 0, z = 0;
+	double vx = 0, vy = 0, vz = 0;
+	double mass = 1.0;
+	int id = 0;
+};
+
+BEGIN_REFLECT(Particle)
+variables(
+	var(&Particle::x),
+	var(&Particle::y),
+	var(&Particle::z),
+	var(&Particle::vx),
+	var(&Particle::vy),
+	var(&Particle::vz),
+	var(&Particle::mass),
+	var(&Particle::id)
+)
+END_REFLECT()
+
+// Hand-written encoder for the same wire format, as a baseline
+void encode_snapshot_by_hand(const Snapshot& snapshot, std::vector<std::byte>& out) {
+	auto append = [&](const void* data, size_t size) {
+		const auto* bytes = static_cast<const std::byte*>(data);
+		out.insert(out.end(), bytes, bytes + size);
+	};
+	uint64_t count = 0;
+	append(&snapshot.frame, sizeof(snapshot.frame));
+	append(&snapshot.time, sizeof(snapshot.time));
+	append(&snapshot.mode, sizeof(snapshot.mode));
+	count = snapshot.positions.size();
+	append(&count, sizeof(count));
+	for (double position : snapshot.positions) {
+		append(&position, sizeof(position));
+	}
+	count = snapshot.labels.size();
+	append(&count, sizeof(count));
+	for (const auto& label : snapshot.labels) {
+		count = label.size();
+		append(&count, sizeof(count));
+		append(label.data(), label.size());
+	}
+}
+
+void bench_binary_serialization() {
+	namespace sta_ref = my_reflect::static_refl;
+	constexpr size_t iterations = 200000;
+
+	std::cout << "Binary serialization (static TypeData)\n";
+	std::cout << "--------------------------------------\n";
+
+	Snapshot snapshot{42, 1.5, Mode::Running, std::vector<double>(256, 0.25), {"alpha", "beta", "gamma"}};
+
+	std::vector<std::byte> handBuffer;
+	run_benchmark("hand-written encode", iterations, [&](size_t) {
+		handBuffer.clear();
+		encode_snapshot_by_hand(snapshot, handBuffer);
+		do_not_optimize(handBuffer.size());
+	});
+
+	sta_ref::utils::BinaryWriter writer;
+	run_benchmark("to_binary (reused writer)", iterations, [&](size_t) {
+		writer.clear();
+		sta_ref::utils::to_binary(snapshot, writer);
+		do_not_optimize(writer.size());
+	});
+	std::cout << "  same bytes as hand-written: " << (writer.buffer() == handBuffer) << "\n";
+
+	Snapshot decoded;
+	run_benchmark("from_binary (reused object)", iterations, [&](size_t) {
+		sta_ref::utils::from_binary(decoded, writer.buffer());
+		do_not_optimize(decoded.frame);
+	});
+
+	// Eight adjacent raw fields: one write per particle
+	std::vector<Particle> particles(64);
+	run_benchmark("to_binary 64 Particles (reused writer)", iterations / 16, [&](size_t) {
+		writer.clear();
+		for (const auto& particle : particles) {
+			sta_ref::utils::to_binary(particle, writer);
+		}
+		do_not_optimize(writer.size());
+	});
+
+	writer.clear();
+	sta_ref::utils::to_binary(snapshot, writer);
+
+	namespace dyn_ref = my_reflect::dynamic_refl;
+	auto snapshot_any = dyn_ref::make_cref(snapshot);
+	dyn_ref::BinaryWriter dynamicWriter;
+	run_benchmark("dynamic Serialize (field program)", iterations, [&](size_t) {
+		dynamicWriter.clear();
+		dyn_ref::Serialize(snapshot_any, dynamicWriter);
+		do_not_optimize(dynamicWriter.size());
+	});
+	std::cout << "  same bytes as to_binary: " << (dynamicWriter.buffer() == writer.buffer()) << "\n";
+
+	auto decoded_any = dyn_ref::make_ref(decoded);
+	run_benchmark("dynamic Deserialize (reused object)", iterations, [&](size_t) {
+		dyn_ref::Deserialize(decoded_any, dynamicWriter.buffer());
+		do_not_optimize(decoded.frame);
+	});
+
+	std::cout << "\n";
+}
+
+void bench_json() {
+	namespace sta_ref = my_reflect::static_refl;
+	constexpr size_t iterations = 20000;
+
+	std::cout << "JSON (static TypeData)\n";
+	std::cout << "----------------------\n";
+
+	Snapshot snapshot{42, 1.5, Mode::Running, std::vector<double>(256, 0.25), {"alpha", "beta", "gamma"}};
+
+	sta_ref::utils::JsonWriter writer;
+	run_benchmark("to_json (reused writer)", iterations, [&](size_t) {
+		writer.clear();
+		sta_ref::utils::to_json(snapshot, writer);
+		do_not_optimize(writer.size());
+	});
+	std::cout << "  document size: " << writer.size() << " bytes\n";
+
+	Snapshot decoded;
+	run_benchmark("from_json (reused object)", iterations, [&](size_t) {
+		sta_ref::utils::from_json(decoded, writer.str());
+		do_not_optimize(decoded.frame);
+	});
+
+	std::cout << "\n";
+}
+
+void bench_name_lookup() {
+	namespace sta_ref = my_reflect::static_refl;
+	constexpr size_t iterations = 1000000;
+
+	std::cout << "Runtime name -> index (32 names)\n";
+	std::cout << "--------------------------------\n";
+
+	static constexpr std::array<std::string_view, 32> names = {
+		"id", "name", "age", "email", "phone", "city", "zip", "country",
+		"created", "updated", "flags", "owner", "group", "status", "priority", "score",
+		"latitude", "longitude", "altitude", "speed", "heading", "battery", "signal", "firmware",
+		"serial", "model", "vendor", "region", "zone", "rack", "slot", "port"};
+	static constexpr auto table = sta_ref::name_hash_table<32>::build(names);
+
+	std::vector<std::string> queries(names.begin(), names.end());
+	queries.push_back("missing");
+
+	run_benchmark("linear string_view compare", iterations, [&](size_t i) {
+		const std::string& query = queries[i % queries.size()];
+		int result = -1;
+		for (size_t k = 0; k < names.size(); ++k) {
+			if (names[k] == query) {
+				result = static_cast<int>(k);
+				break;
+			}
+		}
+		do_not_optimize(result);
+	});
+
+	run_benchmark("name_hash_table::find", iterations, [&](size_t i) {
+		do_not_optimize(table.find(queries[i % queries.size()]));
+	});
+
+	std::cout << "\n";
+}
+
+void bench_dispatch_by_name() {
+	namespace dyn_ref = my_reflect::dynamic_refl;
+	using SnapshotType = my_reflect::static_refl::TypeData<Snapshot>;
+	using CounterType = my_reflect::static_refl::TypeData<Counter>;
+	constexpr size_t iterations = 1000000;
+
+	std::cout << "Access by runtime name\n";
+	std::cout << "----------------------\n";
+
+	Snapshot snapshot;
+	snapshot.frame = 3;
+	snapshot.time = 1.5;
+	const std::array<std::string, 3> fields = {"frame", "time", "mode"};
+
+	run_benchmark("TypeData::get_by_name (visitor)", iterations, [&](size_t i) {
+		double sum = 0;
+		SnapshotType::get_by_name(snapshot, fields[i % 2], [&](const auto& value) {
+			if constexpr (std::is_arithmetic_v<std::decay_t<decltype(value)>>) {
+				sum += value;
+			}
+		});
+		do_not_optimize(sum);
+	});
+
+	auto snapshot_any = dyn_ref::make_ref(snapshot);
+	const dyn_ref::Class* snapshotClass = dyn_ref::GetType<Snapshot>()->AsClass();
+	run_benchmark("Class::GetMemberValue (Any)", iterations, [&](size_t i) {
+		auto value = snapshotClass->GetMemberValue(snapshot_any, fields[i % 2]);
+		do_not_optimize(value.empty());
+	});
+
+	run_benchmark("TypeData::set_by_name(\"frame\")", iterations, [&](size_t i) {
+		do_not_optimize(SnapshotType::set_by_name(snapshot, fields[0], static_cast<int>(i)));
+	});
+
+	Counter counter;
+	const std::string add = "add";
+	run_benchmark("TypeData::invoke_by_name(\"add\", int)", iterations, [&](size_t i) {
+		int result = 0;
+		CounterType::invoke_by_name(counter, add, [&](int value) { result = value; }, static_cast<int>(i & 1));
+		do_not_optimize(result);
+	});
+
+	auto counter_any = dyn_ref::make_ref(counter);
+	run_benchmark("Any::invoke(\"add\", int)", iterations, [&](size_t i) {
+		auto result = counter_any.invoke(add, static_cast<int>(i & 1));
+		do_not_optimize(*dyn_ref::any_cast<int>(result));
+	});
+
+	std::cout << "\n";
+}
+
+void bench_soa_vector() {
+	namespace sta_ref = my_reflect::static_refl;
+	constexpr size_t rows = 1 << 20;
+	constexpr size_t iterations = 50;
+
+	std::cout << "Single-field scan over " << rows << " Particles (" << sizeof(Particle) << " bytes each)\n";
+	std::cout << "-----------------------------------------------------------\n";
+
+	std::vector<Particle> particles(rows);
+	sta_ref::soa_vector<Particle> columns;
+	columns.reserve(rows);
+	for (size_t i = 0; i < rows; ++i) {
+		particles[i].mass = 1.0 + static_cast<double>(i % 7);
+		columns.push_back(particles[i]);
+	}
+
+	run_benchmark("std::vector<Particle> sum(mass)", iterations, [&](size_t) {
+		double total = 0;
+		for (const Particle& particle : particles) {
+			total += particle.mass;
+		}
+		do_not_optimize(total);
+	});
+
+	constexpr int mass = sta_ref::soa_vector<Particle>::column_index("mass");
+	run_benchmark("soa_vector<Particle> sum(mass)", iterations, [&](size_t) {
+		double total = 0;
+		for (double value : columns.column<mass>()) {
+			total += value;
+		}
+		do_not_optimize(total);
+	});
+
+	std::cout << "\n";
+}
+
+// rows * sizeof(Particle): 4096 rows stay in L2, 1M rows stream from memory
+void bench_bulk_ops(size_t rows, size_t iterations) {
+	namespace sta_ref = my_reflect::static_refl;
+	namespace utils = sta_ref::utils;
+
+	std::cout << "Bulk field ops over std::vector<Particle> (" << rows << " rows)\n";
+	std::cout << "------------------------------------------------------\n";
+
+	std::vector<Particle> particles(rows);
+	for (size_t i = 0; i < rows; ++i) {
+		particles[i].mass = 1.0 + static_cast<double>(i % 7);
+		particles[i].id = static_cast<int>(i * 2654435761u % 100000);
+	}
+	constexpr int mass = sta_ref::TypeData<Particle>::find_variable_index("mass");
+	constexpr int id = sta_ref::TypeData<Particle>::find_variable_index("id");
+	constexpr auto mass_ptr = std::get<mass>(sta_ref::TypeData<Particle>::variables).ptr_;
+	constexpr auto id_ptr = std::get<id>(sta_ref::TypeData<Particle>::variables).ptr_;
+
+	run_benchmark("naive loop sum(obj.*mass)", iterations, [&](size_t) {
+		double total = 0;
+		for (const Particle& particle : particles) {
+			total += particle.*mass_ptr;
+		}
+		do_not_optimize(total);
+	});
+
+	run_benchmark("naive loop max(obj.*id)", iterations, [&](size_t) {
+		int result = particles[0].*id_ptr;
+		for (const Particle& particle : particles) {
+			result = result < particle.*id_ptr ? particle.*id_ptr : result;
+		}
+		do_not_optimize(result);
+	});
+
+	for (auto level : {utils::simd_level::Scalar, utils::detected_simd_level()}) {
+		utils::set_simd_level(level);
+		std::string suffix = level == utils::simd_level::AVX2 ? " [AVX2]" : " [scalar]";
+		run_benchmark("bulk_sum<mass>" + suffix, iterations, [&](size_t) {
+			do_not_optimize(utils::bulk_sum<mass>(particles));
+		});
+		run_benchmark("bulk_max<id>" + suffix, iterations, [&](size_t) {
+			do_not_optimize(utils::bulk_max<id>(particles));
+		});
+	}
+
+	std::vector<double> column(rows, 1.5);
+	run_benchmark("strided_sum contiguous doubles", iterations, [&](size_t) {
+		do_not_optimize(utils::strided_sum(column.data(), column.size()));
+	});
+
+	std::cout << "\n";
+}
+
+void bench_any_boxing() {
+	namespace dyn_ref = my_reflect::dynamic_refl;
+	constexpr size_t iterations = 1000000;
+
+	std::cout << "Any boxing (sizeof(Any) = " << sizeof(dyn_ref::Any) << ")\n";
+	std::cout << "-------------------------------\n";
+
+	run_benchmark("make_copy<int>", iterations, [](size_t i) {
+		auto any = dyn_ref::make_copy(static_cast<int>(i));
+		do_not_optimize(*dyn_ref::any_cast<int>(any));
+	});
+
+	run_benchmark("make_copy<double>", iterations, [](size_t i) {
+		auto any = dyn_ref::make_copy(static_cast<double>(i));
+		do_not_optimize(*dyn_ref::any_cast<double>(any));
+	});
+
+	run_benchmark("make_copy<Mode>", iterations, [](size_t i) {
+		auto any = dyn_ref::make_copy(static_cast<Mode>(i % 3));
+		do_not_optimize(*dyn_ref::any_cast<Mode>(any));
+	});
+
+	run_benchmark("make_copy<std::string> (heap)", iterations, [](size_t) {
+		auto any = dyn_ref::make_copy(std::string("a string that is too long for SSO"));
+		do_not_optimize(dyn_ref::any_cast<std::string>(any)->size());
+	});
+
+	// A request that boxes 64 strings and drops them together
+	const std::string long_text = "a string that is too long for SSO";
+	run_benchmark("64 x make_copy<std::string> (heap)", iterations / 64, [&](size_t) {
+		std::vector<dyn_ref::Any> values;
+		values.reserve(64);
+		for (int k = 0; k < 64; ++k) {
+			values.push_back(dyn_ref::make_copy(long_text));
+		}
+		do_not_optimize(values.back().payload);
+	});
+
+	dyn_ref::AnyArena arena;
+	run_benchmark("64 x make_copy<std::string> (arena)", iterations / 64, [&](size_t) {
+		{
+			std::vector<dyn_ref::Any> values;
+			values.reserve(64);
+			for (int k = 0; k < 64; ++k) {
+				values.push_back(dyn_ref::make_copy(arena, long_text));
+			}
+			do_not_optimize(values.back().payload);
+		}
+		arena.reset();
+	});
+
+	run_benchmark("copy Any<int>", iterations, [source = dyn_ref::make_copy(7)](size_t) {
+		dyn_ref::Any copy = source;
+		do_not_optimize(*dyn_ref::any_cast<int>(copy));
+	});
+
+	run_benchmark("any_cast<int> hit", iterations, [source = dyn_ref::make_copy(7)](size_t) {
+		do_not_optimize(dyn_ref::any_cast<int>(source) != nullptr);
+	});
+
+	run_benchmark("any_cast<double> miss", iterations, [source = dyn_ref::make_copy(7)](size_t) {
+		do_not_optimize(dyn_ref::any_cast<double>(source) != nullptr);
+	});
+
+	std::cout << "\n";
+}
+
+void bench_invoke() {
+	namespace dyn_ref = my_reflect::dynamic_refl;
+	constexpr size_t iterations = 1000000;
+
+	std::cout << "MemberFunction::Invoke\n";
+	std::cout << "----------------------\n";
+
+	Counter counter;
+	auto counter_any = dyn_ref::make_ref(counter);
+
+	run_benchmark("Any::invoke(\"add\", int)", iterations, [&](size_t i) {
+		auto result = counter_any.invoke("add", static_cast<int>(i & 1));
+		do_not_optimize(*dyn_ref::any_cast<int>(result));
+	});
+
+	run_benchmark("Any::invoke(\"get\")", iterations, [&](size_t) {
+		auto result = counter_any.invoke("get");
+		do_not_optimize(*dyn_ref::any_cast<int>(result));
+	});
+
+	const dyn_ref::MemberFunction* add = dyn_ref::GetType<Counter>()->AsClass()->FindFunction("add");
+
+	run_benchmark("MemberFunction::Invoke(vector<Any>)", iterations, [&](size_t i) {
+		std::vector<dyn_ref::Any> args;
+		args.push_back(dyn_ref::make_copy(static_cast<int>(i & 1)));
+		auto result = add->Invoke(counter_any, args);
+		do_not_optimize(*dyn_ref::any_cast<int>(result));
+	});
+
+	run_benchmark("MemberFunction::Invoke(ArgSpan)", iterations, [&](size_t i) {
+		int delta = static_cast<int>(i & 1);
+		std::array<dyn_ref::AnyView, 1> args{dyn_ref::make_view(delta)};
+		auto result = add->Invoke(counter_any, dyn_ref::ArgSpan(args));
+		do_not_optimize(*dyn_ref::any_cast<int>(result));
+	});
+
+	dyn_ref::CallPlan add_plan(*add, dyn_ref::GetType<Counter>(), {dyn_ref::GetType<int>()});
+	run_benchmark("CallPlan(view)", iterations, [&](size_t i) {
+		int delta = static_cast<int>(i & 1);
+		auto result = add_plan(counter_any, dyn_ref::make_view(delta));
+		do_not_optimize(*dyn_ref::any_cast<int>(result));
+	});
+
+	std::cout << "\n";
+}
+
+void bench_invoke_batch() {
+	namespace dyn_ref = my_reflect::dynamic_refl;
+	constexpr size_t count = 100000;
+	constexpr size_t iterations = 100;
+
+	std::cout << "Counter::add over " << count << " instances (per batch)\n";
+	std::cout << "------------------------------------------\n";
+
+	std::vector<Counter> counters(count);
+	std::vector<dyn_ref::Any> instances;
+	instances.reserve(count);
+	for (Counter& counter : counters) {
+		instances.push_back(dyn_ref::make_ref(counter));
+	}
+	const dyn_ref::MemberFunction* add = dyn_ref::GetType<Counter>()->AsClass()->FindFunction("add");
+	int delta = 1;
+	std::array<dyn_ref::AnyView, 1> args{dyn_ref::make_view(delta)};
+	std::vector<dyn_ref::Any> results(count);
+
+	run_benchmark("loop of Any::invoke(\"add\", int)", iterations, [&](size_t) {
+		for (size_t i = 0; i < count; ++i) {
+			results[i] = instances[i].invoke("add", delta);
+		}
+	});
+
+	dyn_ref::CallPlan plan(*add, dyn_ref::GetType<Counter>(), {dyn_ref::GetType<int>()});
+	run_benchmark("loop of CallPlan", iterations, [&](size_t) {
+		for (size_t i = 0; i < count; ++i) {
+			results[i] = plan(instances[i], dyn_ref::ArgSpan(args));
+		}
+	});
+
+	run_benchmark("InvokeBatch", iterations, [&](size_t) {
+		add->InvokeBatch(instances.data(), count, dyn_ref::ArgSpan(args), results.data());
+	});
+
+	run_benchmark("InvokeBatch, results discarded", iterations, [&](size_t) {
+		add->InvokeBatch(instances.data(), count, dyn_ref::ArgSpan(args));
+	});
+
+	dyn_ref::ThreadPool pool;
+	dyn_ref::BatchOptions options;
+	options.pool = &pool;
+	run_benchmark("InvokeBatch, pool of " + std::to_string(pool.GetWorkerCount() + 1) + " threads", iterations, [&](size_t) {
+		add->InvokeBatch(instances.data(), count, dyn_ref::ArgSpan(args), results.data(), options);
+	});
+	do_not_optimize(counters[count - 1].get());
+
+	std::cout << "\n";
+}
+
+void bench_container_iteration() {
+	namespace dyn_ref = my_reflect::dynamic_refl;
+	constexpr size_t count = 1 << 20;
+	constexpr size_t iterations = 20;
+
+	std::cout << "Full scan of a reflected std::vector<int> (" << count << " elements)\n";
+	std::cout << "------------------------------------------------------\n";
+
+	std::vector<int> values(count, 1);
+	auto info = dyn_ref::MemberContainer::Create<std::vector<int>>("values");
+	auto values_any = dyn_ref::make_cref(values);
+
+	run_benchmark("native loop", iterations, [&](size_t) {
+		long long total = 0;
+		for (int value : values) {
+			total += value;
+		}
+		do_not_optimize(total);
+	});
+
+	run_benchmark("container_ops::At per index", iterations, [&](size_t) {
+		long long total = 0;
+		for (size_t i = 0; i < count; ++i) {
+			total += *dyn_ref::any_cast<int>(dyn_ref::container_ops::At(info, values_any, i));
+		}
+		do_not_optimize(total);
+	});
+
+	run_benchmark("container_ops cursor", iterations, [&](size_t) {
+		long long total = 0;
+		for (auto cursor = dyn_ref::container_ops::Begin(info, values_any); cursor.valid;
+		     dyn_ref::container_ops::Next(info, cursor)) {
+			total += *static_cast<const int*>(cursor.element.value.payload);
+		}
+		do_not_optimize(total);
+	});
+
+	run_benchmark("container_ops::ForEach", iterations, [&](size_t) {
+		long long total = 0;
+		dyn_ref::container_ops::ForEach(info, values_any, [&](const dyn_ref::ContainerElement& element) {
+			total += *static_cast<const int*>(element.value.payload);
+		});
+		do_not_optimize(total);
+	});
+
+	std::map<int, int> table;
+	for (int i = 0; i < 1 << 16; ++i) {
+		table[i] = i;
+	}
+	auto mapInfo = dyn_ref::MemberContainer::Create<std::map<int, int>>("table");
+	auto table_any = dyn_ref::make_cref(table);
+	run_benchmark("native std::map<int, int> loop (64K)", iterations, [&](size_t) {
+		long long total = 0;
+		for (const auto& [key, value] : table) {
+			total += value;
+		}
+		do_not_optimize(total);
+	});
+	run_benchmark("container_ops::ForEach over map (64K)", iterations, [&](size_t) {
+		long long total = 0;
+		dyn_ref::container_ops::ForEach(mapInfo, table_any, [&](const dyn_ref::ContainerElement& element) {
+			total += *static_cast<const int*>(element.value.payload);
+		});
+		do_not_optimize(total);
+	});
+
+	std::cout << "\n";
+}
+
+void bench_container_fill() {
+	namespace dyn_ref = my_reflect::dynamic_refl;
+	constexpr size_t count = 1 << 20;
+	constexpr size_t iterations = 20;
+
+	std::cout << "Filling a reflected std::vector<double> with " << count << " values\n";
+	std::cout << "----------------------------------------------------------\n";
+
+	std::vector<double> source(count, 0.5);
+	std::vector<double> target;
+	auto info = dyn_ref::MemberContainer::Create<std::vector<double>>("target");
+	auto target_any = dyn_ref::make_ref(target);
+
+	run_benchmark("container_ops::Push per element", iterations, [&](size_t) {
+		dyn_ref::container_ops::Clear(info, target_any);
+		for (double value : source) {
+			dyn_ref::container_ops::Push(info, target_any, dyn_ref::make_cref(value));
+		}
+		do_not_optimize(target.size());
+	});
+
+	run_benchmark("container_ops::AssignRange", iterations, [&](size_t) {
+		dyn_ref::container_ops::AssignRange(info, target_any, source.data(), source.size());
+		do_not_optimize(target.size());
+	});
+
+	run_benchmark("Resize + Contiguous memcpy", iterations, [&](size_t) {
+		dyn_ref::container_ops::Resize(info, target_any, count);
+		dyn_ref::ContiguousBlock block = dyn_ref::container_ops::Contiguous(info, target_any);
+		std::memcpy(block.data, source.data(), block.count * block.stride);
+		do_not_optimize(target.size());
+	});
+
+	std::cout << "\n";
+}
+
+void bench_container_lookup() {
+	namespace dyn_ref = my_reflect::dynamic_refl;
+	constexpr int keys = 1 << 16;
+	constexpr size_t iterations = 1000000;
+
+	std::cout << "container_ops::ContainsKey over " << keys << " int keys\n";
+	std::cout << "---------------------------------------------\n";
+
+	std::map<int, int> ordered;
+	std::unordered_map<int, int> hashed;
+	for (int i = 0; i < keys; ++i) {
+		ordered[i * 7] = i;
+		hashed[i * 7] = i;
+	}
+	auto orderedInfo = dyn_ref::MemberContainer::Create<std::map<int, int>>("ordered");
+	auto hashedInfo = dyn_ref::MemberContainer::Create<std::unordered_map<int, int>>("hashed");
+	auto ordered_any = dyn_ref::make_cref(ordered);
+	auto hashed_any = dyn_ref::make_cref(hashed);
+
+	int key = 0;
+	auto key_any = dyn_ref::make_ref(key);
+	run_benchmark("std::map", iterations, [&](size_t i) {
+		key = static_cast<int>((i * 2654435761u) % (keys * 7));
+		do_not_optimize(dyn_ref::container_ops::ContainsKey(orderedInfo, ordered_any, key_any));
+	});
+	run_benchmark("std::unordered_map", iterations, [&](size_t i) {
+		key = static_cast<int>((i * 2654435761u) % (keys * 7));
+		do_not_optimize(dyn_ref::container_ops::ContainsKey(hashedInfo, hashed_any, key_any));
+	});
+
+	std::cout << "\n";
+}
+
+void bench_container_move_insert() {
+	namespace dyn_ref = my_reflect::dynamic_refl;
+	constexpr size_t entries = 1000;
+	constexpr size_t iterations = 200;
+
+	std::cout << "Loading " << entries << " (string key, 1 KB string value) pairs into a reflected std::map\n";
+	std::cout << "--------------------------------------------------------------------------\n";
+
+	std::vector<std::string> keys;
+	std::vector<std::string> values;
+	for (size_t i = 0; i < entries; ++i) {
+		keys.push_back("key-" + std::to_string(i) + std::string(24, 'k'));
+		values.push_back(std::string(1024, static_cast<char>('a' + i % 26)));
+	}
+	auto info = dyn_ref::MemberContainer::Create<std::map<std::string, std::string>>("table");
+
+	// Both variants start from owned Anys holding a copy of the source strings
+	run_benchmark("container_ops::InsertKV", iterations, [&](size_t) {
+		std::map<std::string, std::string> table;
+		auto table_any = dyn_ref::make_ref(table);
+		for (size_t i = 0; i < entries; ++i) {
+			dyn_ref::container_ops::InsertKV(info, table_any, dyn_ref::make_copy(keys[i]), dyn_ref::make_copy(values[i]));
+		}
+		do_not_optimize(table.size());
+	});
+
+	run_benchmark("container_ops::EmplaceKV", iterations, [&](size_t) {
+		std::map<std::string, std::string> table;
+		auto table_any = dyn_ref::make_ref(table);
+		for (size_t i = 0; i < entries; ++i) {
+			dyn_ref::container_ops::EmplaceKV(info, table_any, dyn_ref::make_copy(keys[i]), dyn_ref::make_copy(values[i]));
+		}
+		do_not_optimize(table.size());
+	});
+
+	std::cout << "\n";
+}
+
+void bench_enum_lookup() {
+	namespace dyn_ref = my_reflect::dynamic_refl;
+	constexpr size_t items = 64;
+	constexpr size_t iterations = 1000000;
+
+	std::cout << "Enum lookups (" << items << " enumerators)\n";
+	std::cout << "-------------------------\n";
+
+	// Same names, once with values 0..63 and once spread out so the sorted fallback is used
+	auto& factory = dyn_ref::Register<StatusCode>().Register("StatusCode");
+	dyn_ref::Enum sparse("SparseCode", sizeof(int));
+	std::vector<std::string> names;
+	for (size_t i = 0; i < items; ++i) {
+		names.push_back("STATUS_CODE_" + std::to_string(i * 37));
+		factory.Add(names.back(), static_cast<int>(i));
+		sparse.add(names.back(), static_cast<int>(i * 37));
+	}
+	const dyn_ref::Enum& dense = factory.GetInfo();
+	std::cout << "dense table: " << dense.IsDense() << ", sparse table: " << sparse.IsDense() << "\n";
+
+	run_benchmark("value -> name, linear scan", iterations, [&](size_t i) {
+		const long long value = static_cast<long long>(i % items);
+		std::string_view result;
+		for (const auto& item : dense.GetItems()) {
+			if (item.value_ == value) {
+				result = item.name_;
+				break;
+			}
+		}
+		do_not_optimize(result.size());
+	});
+	run_benchmark("value -> name, FindName dense", iterations, [&](size_t i) {
+		do_not_optimize(dense.FindName(static_cast<long long>(i % items)).size());
+	});
+	run_benchmark("value -> name, FindName sorted", iterations, [&](size_t i) {
+		do_not_optimize(sparse.FindName(static_cast<long long>(i % items * 37)).size());
+	});
+
+	run_benchmark("name -> value, linear scan", iterations, [&](size_t i) {
+		const std::string& name = names[i % items];
+		long long result = -1;
+		for (const auto& item : dense.GetItems()) {
+			if (item.name_ == name) {
+				result = item.value_;
+				break;
+			}
+		}
+		do_not_optimize(result);
+	});
+	run_benchmark("name -> value, FindValue", iterations, [&](size_t i) {
+		do_not_optimize(dense.FindValue(names[i % items]).value_or(-1));
+	});
+
+	StatusCode code{};
+	auto code_any = dyn_ref::make_ref(code);
+	run_benchmark("GetName (optional<string>)", iterations, [&](size_t i) {
+		code = static_cast<StatusCode>(i % items);
+		do_not_optimize(dense.GetName(code_any)->size());
+	});
+	run_benchmark("GetNameView (string_view)", iterations, [&](size_t i) {
+		code = static_cast<StatusCode>(i % items);
+		do_not_optimize(dense.GetNameView(code_any).size());
+	});
+
+	std::cout << "\n";
+}
+
+// Runs the same body through std::function and Thunk so only the wrapper differs
+template <typename Signature, typename Body, typename... CallArgs>
+void compare_wrappers(const std::string& name, size_t iterations, Body body, CallArgs&... callArgs) {
+	namespace dyn_ref = my_reflect::dynamic_refl;
+	std::function<Signature> function = body;
+	dyn_ref::Thunk<Signature> thunk = body;
+
+	run_benchmark(name + " std::function", iterations, [&](size_t) {
+		do_not_optimize(function(callArgs...));
+	});
+	run_benchmark(name + " Thunk", iterations, [&](size_t) {
+		do_not_optimize(thunk(callArgs...));
+	});
+}
+
+void bench_thunks() {
+	namespace dyn_ref = my_reflect::dynamic_refl;
+	constexpr size_t iterations = 1000000;
+
+	std::cout << "std::function vs Thunk\n";
+	std::cout << "----------------------\n";
+
+	Counter counter;
+	auto counter_any = dyn_ref::make_ref(counter);
+	int delta = 1;
+	std::array<dyn_ref::AnyView, 1> views{dyn_ref::make_view(delta)};
+	dyn_ref::ArgSpan args(views);
+
+	auto invokeBody = [funcPtr = &Counter::add](dyn_ref::Any& instance, dyn_ref::ArgSpan callArgs) -> int {
+		return (dyn_ref::any_cast<Counter>(instance)->*funcPtr)(*dyn_ref::view_cast<int>(callArgs[0]));
+	};
+	compare_wrappers<int(dyn_ref::Any&, dyn_ref::ArgSpan)>("Invoke", iterations, invokeBody, counter_any, args);
+
+	std::vector<int> vec(16, 1);
+	auto vec_any = dyn_ref::make_ref(vec);
+	auto value_any = dyn_ref::make_copy(3);
+	size_t index = 5;
+
+	auto sizeBody = [](const dyn_ref::Any& any) -> size_t {
+		return dyn_ref::any_cast<std::vector<int>>(any)->size();
+	};
+	compare_wrappers<size_t(const dyn_ref::Any&)>("Size", iterations, sizeBody, vec_any);
+
+	auto pushBody = [](dyn_ref::Any& any, const dyn_ref::Any& value) -> bool {
+		auto* v = dyn_ref::any_cast<std::vector<int>>(any);
+		v->push_back(*dyn_ref::any_cast<int>(value));
+		if (v->size() > 1024) {
+			v->resize(16);
+		}
+		return true;
+	};
+	compare_wrappers<bool(dyn_ref::Any&, const dyn_ref::Any&)>("Push", iterations, pushBody, vec_any, value_any);
+
+	auto atBody = [](const dyn_ref::Any& any, size_t i) -> int {
+		return (*dyn_ref::any_cast<std::vector<int>>(any))[i];
+	};
+	compare_wrappers<int(const dyn_ref::Any&, size_t)>("At", iterations, atBody, vec_any, index);
+
+	std::cout << "\n";
+}
+
+int main() {
+	namespace dyn_ref = my_reflect::dynamic_refl;
+
+	dyn_ref::Register<Mode>()
+		.Register("Mode")
+		.Add("Idle", Mode::Idle)
+		.Add("Running", Mode::Running)
+		.Add("Stopped", Mode::Stopped);
+
+	dyn_ref::Register<Counter>()
+		.Register("Counter")
+		.Add("add", &Counter::add)
+		.Add("get", &Counter::get);
+
+	dyn_ref::Register<Snapshot>()
+		.Register("Snapshot")
+		.Add("frame", &Snapshot::frame)
+		.Add("time", &Snapshot::time)
+		.Add("mode", &Snapshot::mode)
+		.Add("positions", &Snapshot::positions)
+		.Add("labels", &Snapshot::labels);
+
+	bench_any_boxing();
+	bench_invoke();
+	bench_invoke_batch();
+	bench_container_iteration();
+	bench_container_fill();
+	bench_container_lookup();
+	bench_container_move_insert();
+	bench_enum_lookup();
+	bench_thunks();
+	bench_binary_serialization();
+	bench_json();
+	bench_name_lookup();
+	bench_dispatch_by_name();
+	bench_soa_vector();
+	bench_bulk_ops(4096, 20000);
+	bench_bulk_ops(1 << 20, 50);
+	return 0;
+}
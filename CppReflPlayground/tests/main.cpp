@@ -1,14 +1,29 @@
 #include <cassert>
+#include <cmath>
+#include <array>
+#include <atomic>
+#include <deque>
 #include <string>
 #include <iostream>
+#include <limits>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
 #include "../include/static_refl/reflect_core.h"
 #include "../include/static_refl/reflect_utils.h"
+#include "../include/static_refl/binary_serializer.h"
+#include "../include/static_refl/json_serializer.h"
+#include "../include/static_refl/soa_vector.h"
+#include "../include/static_refl/bulk_ops.h"
 #include "../include/static_refl/type_list.h"
 #include "../include/dynamic_refl/dynamic_reflect_core.h"
 #include "../include/dynamic_refl/Any.h"
+#include "../include/dynamic_refl/AnyArena.h"
 #include "../include/dynamic_refl/Arithmetic.h"
 #include "../include/dynamic_refl/MemberContainer.h"
 #include "../include/dynamic_refl/container_operations.h"
+#include "../include/dynamic_refl/BinarySerializer.h"
+#include "../include/dynamic_refl/ThreadPool.h"
 
 
 static int g_value = 3;
@@ -120,6 +135,147 @@ END_REFLECT()
 
 enum class Color { red, green, blue };
 
+enum class Level { low, mid, high };
+enum class HttpStatus : uint16_t { ok = 200, created = 201, notFound = 404, teapot = 418, unavailable = 503 };
+
+struct Opaque {
+	int hidden = 0;
+};
+
+struct Holder {
+	int id = 0;
+	Opaque opaque;
+};
+
+struct Reading {
+	int sensor = 0;
+	double value = 0.0;
+	Color color = Color::red;
+	std::vector<float> samples;
+	std::vector<std::string> tags;
+};
+
+BEGIN_REFLECT(Reading)
+variables(
+	var(&Reading::sensor),
+	var(&Reading::value),
+	var(&Reading::color)
+)
+containers(
+	container(&Reading::samples),
+	container(&Reading::tags)
+)
+END_REFLECT()
+
+struct Gauge {
+	uint8_t level = 0;
+};
+
+BEGIN_REFLECT(Gauge)
+variables(
+	var(&Gauge::level)
+)
+END_REFLECT()
+
+// A const data member can be read through reflection but never written
+struct Badge {
+	const int id;
+	std::string owner;
+};
+
+// Polymorphic class with two bases and no default constructor: member and base offsets are
+// measured on the instance being serialized
+struct Shape {
+	virtual ~Shape() = default;
+	int sides = 0;
+};
+
+struct Labeled {
+	std::string label;
+};
+
+struct Tile : Labeled, Shape {
+	double size;
+	explicit Tile(double size) : size(size) {}
+};
+
+// No default constructor, and the copy throws once copiesLeft reaches 0 (-1 = never)
+struct Fragile {
+	static inline int copiesLeft = -1;
+	int value;
+
+	explicit Fragile(int value) : value(value) {}
+	Fragile(const Fragile& other) : value(other.value) {
+		if (copiesLeft == 0) {
+			throw std::runtime_error("Fragile copy failed");
+		}
+		if (copiesLeft > 0) {
+			--copiesLeft;
+		}
+	}
+	Fragile& operator=(const Fragile&) = default;
+};
+
+struct Tagged {
+	int id = 0;
+	Fragile payload{0};
+};
+
+BEGIN_REFLECT(Tagged)
+variables(
+	var(&Tagged::id),
+	var(&Tagged::payload)
+)
+END_REFLECT()
+
+// One member of each hashed / fixed-size / deque container kind
+struct Warehouse {
+	std::unordered_map<std::string, int> stock;
+	std::unordered_set<int> bins;
+	std::deque<std::string> log;
+	std::array<double, 3> origin{};
+	std::array<std::string, 2> labels;
+};
+
+BEGIN_REFLECT(Warehouse)
+containers(
+	container(&Warehouse::stock),
+	container(&Warehouse::bins),
+	container(&Warehouse::log),
+	container(&Warehouse::origin),
+	container(&Warehouse::labels)
+)
+END_REFLECT()
+
+// Counts how often a (heap-sized) value is copied or moved
+struct Tracked {
+	static inline int copies = 0;
+	static inline int moves = 0;
+
+	Tracked() = default;
+	Tracked(const Tracked& other) : bytes(other.bytes) { ++copies; }
+	Tracked(Tracked&& other) noexcept : bytes(other.bytes) { ++moves; }
+	Tracked& operator=(const Tracked&) = default;
+	Tracked& operator=(Tracked&&) noexcept = default;
+
+	std::array<char, 64> bytes{};
+};
+
+struct TrackedFactory {
+	Tracked make() const { return Tracked(); }
+	const Tracked& held() const { return kept; }
+	Tracked& mutableHeld() { return kept; }
+
+	Tracked kept;
+};
+
+struct Tally {
+	int add(int delta) { total += delta; return total; }
+	int get() const { return total; }
+
+	int total = 0;
+};
+
 void test_static_reflection() {
 	namespace sta_ref = my_reflect::static_refl;
 
@@ -363,6 +519,247 @@ void test_static_reflection() {
 	}
 	std::cout << "\n";
 
+	// Test 14: Runtime name lookup through the perfect hash
+	std::cout << "Test 14: Runtime Name Lookup\n";
+	std::cout << "----------------------------\n";
+	{
+		std::string runtimeName = "getAge";
+		std::cout << "find_function_index(runtime \"getAge\"): " << PersonType::find_function_index(runtimeName) << " (expected 2)\n";
+		runtimeName = "scores";
+		std::cout << "find_variable_index(runtime \"scores\"): " << PersonType::find_variable_index(runtimeName) << " (expected -1, containers are separate)\n";
+
+		constexpr auto table = sta_ref::name_hash_table<12>::build({
+			"id", "name", "age", "email", "phone", "city",
+			"zip", "country", "created", "updated", "name", "flags"});
+		static_assert(table.find("flags") == 11, "perfect hash lookup at compile time");
+		bool allFound = true;
+		for (std::string_view key : {"id", "name", "age", "email", "phone", "city", "zip", "country", "created", "updated", "flags"}) {
+			allFound = allFound && table.find(std::string(key)) >= 0;
+		}
+		std::cout << "All 11 distinct names found: " << allFound << " (1=true)\n";
+		std::cout << "Duplicate \"name\" keeps first index: " << table.find("name") << " (expected 1)\n";
+		std::cout << "Unknown name: " << table.find("nickname") << " (expected -1)\n";
+	}
+	std::cout << "\n";
+
+	// Test 15: Binary serialization
+	std::cout << "Test 15: Binary Serialization\n";
+	std::cout << "-----------------------------\n";
+	{
+		Reading reading{7, 2.5, Color::blue, {1.0f, 2.0f, 3.0f}, {"a", "bc"}};
+		auto bytes = sta_ref::utils::to_binary(reading);
+		// 4 + 8 + 4 + (8 + 3*4) + (8 + 8+1 + 8+2)
+		std::cout << "Reading encoded size: " << bytes.size() << " (expected 63)\n";
+
+		Reading decoded;
+		sta_ref::utils::from_binary(decoded, bytes);
+		std::cout << "Decoded sensor/value: " << decoded.sensor << "/" << decoded.value << " (expected 7/2.5)\n";
+		std::cout << "Decoded color is blue: " << (decoded.color == Color::blue) << " (1=true)\n";
+		std::cout << "Decoded samples: " << decoded.samples.size() << ", last " << decoded.samples.back() << " (expected 3, last 3)\n";
+		std::cout << "Decoded tags: " << decoded.tags[0] << " " << decoded.tags[1] << " (expected a bc)\n";
+
+		// sensor is followed by padding; value and color are adjacent and copied as one block
+		const auto& runs = sta_ref::utils::detail::raw_runs(reading, sta_ref::TypeData<Reading>::variables);
+		std::cout << "Reading raw runs: " << runs[0] << " " << runs[1] << " " << runs[2] << " (expected 4 12 0)\n";
+
+		Student student("Nina", 20, 1234);
+		student.friends = {"Omar"};
+		student.luckyNumbers = {3, 9};
+		student.scores = {{"math", 95}};
+		auto studentBytes = sta_ref::utils::to_binary(student);
+
+		Student restored("", 0, 0);
+		sta_ref::utils::from_binary(restored, studentBytes);
+		std::cout << "Restored student: " << restored.name << ", " << restored.age << ", id " << restored.studentID
+		          << " (expected Nina, 20, id 1234)\n";
+		std::cout << "Restored base containers: " << restored.friends.size() << " friend, "
+		          << restored.luckyNumbers.size() << " lucky numbers, math=" << restored.scores["math"]
+		          << " (expected 1 friend, 2 lucky numbers, math=95)\n";
+
+		studentBytes.pop_back();
+		try {
+			sta_ref::utils::from_binary(restored, studentBytes);
+			std::cout << "ERROR: truncated input was accepted\n";
+		} catch (const std::runtime_error& e) {
+			std::cout << "Truncated input rejected: " << e.what() << "\n";
+		}
+	}
+	std::cout << "\n";
+
+	// Test 16: Get / set / invoke by runtime name
+	std::cout << "Test 16: Dispatch by Runtime Name\n";
+	std::cout << "---------------------------------\n";
+	{
+		Person dispatchPerson("Mia", 28);
+		std::string field = "age";
+		bool found = PersonType::get_by_name(dispatchPerson, field, [](auto& value) {
+			std::cout << "get_by_name(\"age\") visits: " << value << " (expected 28)\n";
+		});
+		std::cout << "Found: " << found << " (1=true)\n";
+		std::cout << "Missing field found: " << PersonType::get_by_name(dispatchPerson, "salary", [](auto&) {}) << " (expected 0)\n";
+
+		std::cout << "set_by_name(\"age\", 29): " << PersonType::set_by_name(dispatchPerson, field, 29) << " (1=true)\n";
+		std::cout << "set_by_name(\"name\", \"Leo\"): " << PersonType::set_by_name(dispatchPerson, "name", "Leo") << " (1=true)\n";
+		std::cout << "set_by_name(\"age\", \"text\"): " << PersonType::set_by_name(dispatchPerson, "age", "text")
+		          << " (expected 0, not assignable)\n";
+		std::cout << "Person now: " << dispatchPerson.name << ", " << dispatchPerson.age << " (expected Leo, 29)\n";
+
+		const Person& constPerson = dispatchPerson;
+		PersonType::get_by_name(constPerson, "name", [](auto& value) {
+			std::cout << "Const visit yields const member: " << std::is_const_v<std::remove_reference_t<decltype(value)>> << " (1=true)\n";
+		});
+
+		std::string method = "getAge";
+		PersonType::invoke_by_name(dispatchPerson, method, [](auto&& result) {
+			std::cout << "invoke_by_name(\"getAge\") returns: " << result << " (expected 29)\n";
+		});
+		bool called = PersonType::invoke_by_name(dispatchPerson, "setName", [](auto&&) {}, std::string("Ada"));
+		std::cout << "invoke_by_name(\"setName\", \"Ada\"): " << called << ", name " << dispatchPerson.name << " (expected 1, name Ada)\n";
+		std::cout << "invoke_by_name(\"getAge\", 1) with wrong arguments: "
+		          << PersonType::invoke_by_name(dispatchPerson, "getAge", [](auto&&) {}, 1) << " (expected 0)\n";
+		std::cout << "invoke_by_name(constPerson, \"setName\"): "
+		          << PersonType::invoke_by_name(constPerson, "setName", [](auto&&) {}, std::string("Zed")) << " (expected 0, non-const)\n";
+	}
+	std::cout << "\n";
+
+	// Test 17: Structure-of-arrays storage
+	std::cout << "Test 17: soa_vector\n";
+	std::cout << "-------------------\n";
+	{
+		sta_ref::soa_vector<Reading> readings;
+		for (int i = 0; i < 10; ++i) {
+			readings.push_back(Reading{i, i * 0.5, i % 2 ? Color::green : Color::red, {1.0f}, {"x"}});
+		}
+		std::cout << "Rows / columns: " << readings.size() << " / " << readings.column_count << " (expected 10 / 3)\n";
+
+		constexpr int valueColumn = sta_ref::soa_vector<Reading>::column_index("value");
+		double sum = 0;
+		for (double value : readings.column<valueColumn>()) {
+			sum += value;
+		}
+		std::cout << "Sum of value column: " << sum << " (expected 22.5)\n";
+
+		auto sensors = readings.column<0>();
+		std::cout << "Sensor column is contiguous: " << (&sensors[9] - &sensors[0] == 9) << " (1=true)\n";
+
+		bool visited = readings.visit_column("color", [](auto column) {
+			if constexpr (std::is_same_v<std::decay_t<decltype(column[0])>, Color>) {
+				std::cout << "visit_column(\"color\") size " << column.size() << ", row 3 green: "
+				          << (column[3] == Color::green) << " (expected 10, 1)\n";
+			}
+		});
+		std::cout << "visit_column(\"samples\") found: " << readings.visit_column("samples", [](auto) {})
+		          << " (expected 0, containers are not columns) / color found: " << visited << "\n";
+
+		Reading row = readings[4];
+		std::cout << "Row 4 as Reading: " << row.sensor << ", " << row.value << ", samples " << row.samples.size()
+		          << " (expected 4, 2, samples 0)\n";
+		readings[4] = Reading{40, 4.5, Color::blue, {}, {}};
+		readings[5].get<0>() = 50;
+		std::cout << "After row writes: " << readings.column<0>()[4] << " " << readings.column<1>()[4] << " "
+		          << readings.at(5).get<0>() << " (expected 40 4.5 50)\n";
+
+		const auto copy = readings;
+		readings.clear();
+		std::cout << "Copy keeps rows after clear: " << copy.size() << " / " << readings.size() << " (expected 10 / 0)\n";
+		try {
+			(void)copy.at(10);
+			std::cout << "ERROR: out-of-range row accepted\n";
+		} catch (const std::out_of_range& e) {
+			std::cout << "Out-of-range row rejected: " << e.what() << "\n";
+		}
+
+		sta_ref::soa_vector<Tagged> tagged;
+		for (int i = 0; i < 8; ++i) {
+			tagged.push_back(Tagged{i, Fragile(i * 10)});
+		}
+		std::cout << "Columns of a type without a default constructor: " << tagged.size() << ", "
+		          << tagged.column<1>()[7].value << " (expected 8, 70)\n";
+		// Growing to 16 rows copies the 8 payloads; the copy of the new row's payload throws
+		Fragile::copiesLeft = 8;
+		try {
+			const Tagged extra{8, Fragile(80)};
+			tagged.push_back(extra);
+			std::cout << "ERROR: throwing copy accepted\n";
+		} catch (const std::runtime_error& e) {
+			std::cout << "Push with a throwing column: " << e.what() << ", columns " << tagged.column<0>().size()
+			          << "/" << tagged.column<1>().size() << " (expected 8/8)\n";
+		}
+		// The payload column's copy constructor throws part way; its block must not leak
+		Fragile::copiesLeft = 3;
+		try {
+			sta_ref::soa_vector<Tagged> taggedCopy = tagged;
+			std::cout << "ERROR: throwing copy accepted\n";
+		} catch (const std::runtime_error& e) {
+			std::cout << "Copy with a throwing column: " << e.what() << "\n";
+		}
+		Fragile::copiesLeft = -1;
+	}
+	std::cout << "\n";
+
+	// Test 18: Bulk field operations
+	std::cout << "Test 18: Bulk Field Operations\n";
+	std::cout << "------------------------------\n";
+	{
+		namespace utils = sta_ref::utils;
+		std::vector<Reading> readings(1003);
+		for (size_t i = 0; i < readings.size(); ++i) {
+			readings[i].sensor = static_cast<int>(i) - 500;
+			readings[i].value = static_cast<double>(i % 10);
+		}
+		constexpr int sensor = sta_ref::TypeData<Reading>::find_variable_index("sensor");
+		constexpr int value = sta_ref::TypeData<Reading>::find_variable_index("value");
+
+		std::cout << "SIMD level: " << (utils::active_simd_level() == utils::simd_level::AVX2 ? "AVX2" : "Scalar") << "\n";
+		auto simdSum = utils::bulk_sum<value>(readings);
+		auto simdMin = utils::bulk_min<sensor>(readings);
+		auto simdMax = utils::bulk_max<sensor>(readings);
+		std::cout << "sum(value): " << simdSum << " (expected 4503)\n";
+		std::cout << "min/max(sensor): " << simdMin << "/" << simdMax << " (expected -500/502)\n";
+		std::cout << "sum(sensor) widened: " << utils::bulk_sum<sensor>(readings) << " (expected 1003)\n";
+
+		utils::set_simd_level(utils::simd_level::Scalar);
+		bool same = utils::bulk_sum<value>(readings) == simdSum && utils::bulk_min<sensor>(readings) == simdMin
+		            && utils::bulk_max<sensor>(readings) == simdMax;
+		utils::set_simd_level(utils::detected_simd_level());
+		std::cout << "Scalar fallback agrees: " << same << " (1=true)\n";
+
+		utils::bulk_fill<value>(readings, 2.0);
+		std::cout << "After fill: sum(value) " << utils::bulk_sum<value>(readings) << ", sensor[7] " << readings[7].sensor
+		          << " (expected 2006, sensor[7] -493)\n";
+
+		std::vector<float> contiguous = {3.0f, -1.5f, 8.0f, 0.25f, 4.0f, 9.5f, -2.0f, 1.0f, 6.0f, 7.0f, -3.5f, 2.0f,
+		                                 5.0f, 0.0f, 1.5f, 2.5f, -4.0f};
+		std::cout << "Contiguous float min/max: " << utils::strided_min(contiguous.data(), contiguous.size()) << "/"
+		          << utils::strided_max(contiguous.data(), contiguous.size()) << " (expected -4/9.5)\n";
+
+		const double nan = std::numeric_limits<double>::quiet_NaN();
+		std::vector<double> withNan(37, 1.0);
+		withNan[0] = nan;
+		withNan[5] = -2.0;
+		withNan[9] = nan;
+		withNan[20] = 8.0;
+		withNan[36] = nan;
+		std::string nanResults;
+		for (auto level : {utils::simd_level::Scalar, utils::detected_simd_level()}) {
+			utils::set_simd_level(level);
+			nanResults += std::to_string(utils::strided_min(withNan.data(), withNan.size())) + "/"
+			              + std::to_string(utils::strided_max(withNan.data(), withNan.size())) + " ";
+		}
+		utils::set_simd_level(utils::detected_simd_level());
+		std::vector<double> allNan(6, nan);
+		std::cout << "Min/max skip NaN on every level: " << nanResults << "(expected -2.000000/8.000000 twice)\n";
+		std::cout << "Min of all-NaN is NaN: " << std::isnan(utils::strided_min(allNan.data(), allNan.size()))
+		          << " (1=true)\n";
+		try {
+			utils::bulk_min<sensor>(std::vector<Reading>{});
+			std::cout << "ERROR: empty min accepted\n";
+		} catch (const std::runtime_error& e) {
+			std::cout << "Empty range rejected: " << e.what() << "\n";
+		}
+	}
+	std::cout << "\n";
+
 	std::cout << "========== All Tests Completed ==========\n";
 }
 
@@ -408,27 +805,27 @@ void test_dynamic_reflection() {
 		.Add("setName", &Person::setName)
 		.Add("getAge", &Person::getAge)
 		.Add("speak", &Person::speak)
-		.Add<decltype(&Person::name)>("name")
-		.Add<decltype(&Person::age)>("age")
-		.Add<decltype(&Person::friends)>("friends")
-		.Add<decltype(&Person::luckyNumbers)>("luckyNumbers")
-		.Add<decltype(&Person::scores)>("scores");
+		.Add("name", &Person::name)
+		.Add("age", &Person::age)
+		.Add("friends", &Person::friends)
+		.Add("luckyNumbers", &Person::luckyNumbers)
+		.Add("scores", &Person::scores);
 
 	const dyn_ref::Type* personType = dyn_ref::GetType("Person");
 	std::cout << "Registered class: " << personType->GetName() << "\n";
 	std::cout << "Type kind: " << (int)personType->GetKind() << " (2=Class)\n";
 
 	const dyn_ref::Class* personClass = static_cast<const dyn_ref::Class*>(personType);
-	std::cout << "Member functions count: " << personClass->memberFunctions_.size() << "\n";
-	std::cout << "Member variables count: " << personClass->memberVariables_.size() << "\n";
-	std::cout << "Member containers count: " << personClass->memberContainers_.size() << "\n";
+	std::cout << "Member functions count: " << personClass->GetMemberFunctions().size() << "\n";
+	std::cout << "Member variables count: " << personClass->GetMemberVariables().size() << "\n";
+	std::cout << "Member containers count: " << personClass->GetMemberContainers().size() << "\n";
 	std::cout << "\n";
 
 	// Test 3: Inspect member functions
 	std::cout << "Test 3: Member Functions Inspection\n";
 	std::cout << "------------------------------------\n";
 
-	for (const auto& func : personClass->memberFunctions_) {
+	for (const auto& func : personClass->GetMemberFunctions()) {
 		std::cout << "Function: " << func.name_ << "\n";
 		std::cout << "  Return type: " << func.retType_->GetName() << "\n";
 		std::cout << "  Parameters count: " << func.argTypes_.size() << "\n";
@@ -446,7 +843,7 @@ void test_dynamic_reflection() {
 	std::cout << "Test 4: Member Variables Inspection\n";
 	std::cout << "------------------------------------\n";
 
-	for (const auto& var : personClass->memberVariables_) {
+	for (const auto& var : personClass->GetMemberVariables()) {
 		std::cout << "Variable: " << var.name_ << "\n";
 		std::cout << "  Type: " << var.type_->GetName() << "\n";
 	}
@@ -456,7 +853,7 @@ void test_dynamic_reflection() {
 	std::cout << "Test 5: Member Containers Inspection\n";
 	std::cout << "-------------------------------------\n";
 
-	for (const auto& container : personClass->memberContainers_) {
+	for (const auto& container : personClass->GetMemberContainers()) {
 		std::cout << "Container: " << container.name_ << "\n";
 		std::cout << "  Kind: " << (int)container.kind_ << " (0=Set, 1=Vector, 2=Map)\n";
 		std::cout << "  Value type: " << container.valueType_->GetName() << "\n";
@@ -481,12 +878,12 @@ void test_dynamic_reflection() {
 	const dyn_ref::Class* studentClass = static_cast<const dyn_ref::Class*>(studentType);
 
 	std::cout << "Registered class: " << studentClass->GetName() << "\n";
-	std::cout << "Base classes count: " << studentClass->baseClasses_.size() << "\n";
-	if (!studentClass->baseClasses_.empty()) {
-		std::cout << "Base class: " << studentClass->baseClasses_[0]->GetName() << "\n";
+	std::cout << "Base classes count: " << studentClass->GetBaseClasses().size() << "\n";
+	if (!studentClass->GetBaseClasses().empty()) {
+		std::cout << "Base class: " << studentClass->GetBaseClasses()[0]->GetName() << "\n";
 	}
-	std::cout << "Member functions count: " << studentClass->memberFunctions_.size() << "\n";
-	std::cout << "Member variables count: " << studentClass->memberVariables_.size() << "\n";
+	std::cout << "Member functions count: " << studentClass->GetMemberFunctions().size() << "\n";
+	std::cout << "Member variables count: " << studentClass->GetMemberVariables().size() << "\n";
 	std::cout << "\n";
 
 	// Test 7: Query type by name
@@ -539,6 +936,72 @@ void test_dynamic_reflection() {
 	std::cout << "bool type: " << boolType->GetName() << " (Kind: " << (int)boolType->GetKind() << ")\n";
 	std::cout << "\n";
 
+	// Test 11: Hashed member lookup by name
+	std::cout << "Test 11: Member Lookup by Name\n";
+	std::cout << "-------------------------------\n";
+
+	std::string_view speakName = "speak";
+	const dyn_ref::MemberFunction* speakFunc = personClass->FindFunction(speakName);
+	const dyn_ref::MemberVariable* ageVar = personClass->FindVariable("age");
+	const dyn_ref::MemberContainer* scoresContainer = personClass->FindContainer("scores");
+
+	std::cout << "FindFunction(\"speak\"): " << (speakFunc ? speakFunc->name_ : "Not found") << "\n";
+	std::cout << "FindVariable(\"age\"): " << (ageVar ? ageVar->type_->GetName() : "Not found") << "\n";
+	std::cout << "FindContainer(\"scores\"): " << (scoresContainer ? scoresContainer->name_ : "Not found") << "\n";
+	std::cout << "FindVariable(\"speak\"): " << (personClass->FindVariable(speakName) ? "found" : "Not found") << " (expected Not found)\n";
+	std::cout << "FindFunction(\"missing\"): " << (personClass->FindFunction("missing") ? "found" : "Not found") << " (expected Not found)\n";
+	std::cout << "\n";
+
+	// Test 12: Concurrent registration and lookup
+	std::cout << "Test 12: Concurrent Registry Access\n";
+	std::cout << "-----------------------------------\n";
+	{
+		constexpr int pluginCount = 200;
+		static std::deque<dyn_ref::Class> pluginTypes;
+		for (int i = 0; i < pluginCount; ++i) {
+			pluginTypes.emplace_back("Plugin_" + std::to_string(i));
+		}
+
+		std::atomic<bool> done{false};
+		std::atomic<int> misses{0};
+		std::vector<std::thread> readers;
+		for (int r = 0; r < 4; ++r) {
+			readers.emplace_back([&]() {
+				while (!done.load()) {
+					// Types registered before the plugins must always be visible
+					if (dyn_ref::GetType("Person") == nullptr || dyn_ref::GetType("int") == nullptr) {
+						++misses;
+					}
+					dyn_ref::GetType("Plugin_" + std::to_string(pluginCount / 2));
+				}
+			});
+		}
+
+		std::thread writer([&]() {
+			for (auto& type : pluginTypes) {
+				dyn_ref::TypeRegistry::Instance().RegisterType(type.GetName(), &type);
+			}
+		});
+		writer.join();
+		done = true;
+		for (auto& reader : readers) {
+			reader.join();
+		}
+
+		int found = 0;
+		for (int i = 0; i < pluginCount; ++i) {
+			if (dyn_ref::GetType("Plugin_" + std::to_string(i)) == &pluginTypes[i]) {
+				++found;
+			}
+		}
+		auto interned = dyn_ref::TypeRegistry::Instance().Intern("Plugin_7");
+		std::cout << "Plugins registered while reading: " << found << "/" << pluginCount << "\n";
+		std::cout << "Missed lookups of existing types: " << misses.load() << " (expected 0)\n";
+		std::cout << "Lookup by interned name: "
+		          << (dyn_ref::TypeRegistry::Instance().GetTypeByName(interned) == &pluginTypes[7]) << " (1=true)\n";
+	}
+	std::cout << "\n";
+
 	std::cout << "========== All Dynamic Tests Completed ==========\n";
 }
 
@@ -671,6 +1134,106 @@ void test_any() {
 	}
 	std::cout << "Scope exited.\n\n";
 
+	// Test 9: Small-buffer storage
+	std::cout << "Test 9: Small-Buffer Storage\n";
+	std::cout << "----------------------------\n";
+	{
+		auto int_any = dyn_ref::make_copy(42);
+		auto color_any = dyn_ref::make_copy(Color::blue);
+		Person p11("Kate", 26);
+		auto person_any = dyn_ref::make_copy(p11);
+
+		std::cout << "int stored inline: " << int_any.is_inline() << " (1=true)\n";
+		std::cout << "Color stored inline: " << color_any.is_inline() << " (1=true)\n";
+		std::cout << "Person stored inline: " << person_any.is_inline() << " (0=false)\n";
+
+		auto moved_any = std::move(int_any);
+		auto copied_any = moved_any;
+		dyn_ref::any_set(copied_any, 7);
+		std::cout << "Moved int value: " << dyn_ref::any_get<int>(moved_any).value_or(-1) << " (expected 42)\n";
+		std::cout << "Copied int value after set: " << dyn_ref::any_get<int>(copied_any).value_or(-1) << " (expected 7)\n";
+		std::cout << "Moved int still inline: " << moved_any.is_inline() << " (1=true)\n";
+	}
+	std::cout << "\n";
+
+	// Test 10: Shared operation table
+	std::cout << "Test 10: Shared Operation Table\n";
+	std::cout << "-------------------------------\n";
+	{
+		auto a = dyn_ref::make_copy(std::string("same"));
+		auto b = dyn_ref::make_copy(std::string("same"));
+		auto c = dyn_ref::make_copy(std::string("other"));
+		auto i = dyn_ref::make_copy(5);
+
+		std::cout << "sizeof(Any): " << sizeof(dyn_ref::Any) << "\n";
+		std::cout << "Same vtable for two strings: " << (a.ops == b.ops) << " (1=true)\n";
+		std::cout << "vtable size/alignment of std::string: " << a.ops->size << "/" << a.ops->alignment << "\n";
+		std::cout << "\"same\" equals \"same\": " << a.equals(b) << " (1=true)\n";
+		std::cout << "\"same\" equals \"other\": " << a.equals(c) << " (0=false)\n";
+		std::cout << "string equals int: " << a.equals(i) << " (0=false)\n";
+		std::cout << "Equal strings hash equally: " << (a.hash() == b.hash()) << " (1=true)\n";
+
+		std::vector<Person> people;
+		auto people_any = dyn_ref::make_ref(people);
+		std::cout << "vector<Person> has equality: " << (people_any.ops->equal != nullptr) << " (0=false)\n";
+	}
+	std::cout << "\n";
+
+	// Test 11: Type ids
+	std::cout << "Test 11: Type Ids\n";
+	std::cout << "-----------------\n";
+	{
+		auto int_any = dyn_ref::make_copy(3);
+		auto copied_any = int_any;
+		dyn_ref::Any empty_any;
+
+		std::cout << "int id matches its Type: " << (dyn_ref::GetTypeId<int>() == dyn_ref::GetType<int>()->GetId()) << " (1=true)\n";
+		std::cout << "const int& shares int's id: " << (dyn_ref::GetTypeId<const int&>() == dyn_ref::GetTypeId<int>()) << " (1=true)\n";
+		std::cout << "int and Person ids differ: " << (dyn_ref::GetTypeId<int>() != dyn_ref::GetTypeId<Person>()) << " (1=true)\n";
+		std::cout << "Any caches the id: " << (int_any.typeId == dyn_ref::GetTypeId<int>()) << " (1=true)\n";
+		std::cout << "Copy keeps the id: " << (copied_any.typeId == int_any.typeId) << " (1=true)\n";
+		std::cout << "Empty Any id: " << empty_any.typeId << " (expected 0)\n";
+		std::cout << "any_cast<double> on int: " << (dyn_ref::any_cast<double>(int_any) == nullptr) << " (1=true)\n";
+	}
+	std::cout << "\n";
+
+	// Test 12: Arena-backed Any
+	std::cout << "Test 12: Arena-backed Any\n";
+	std::cout << "-------------------------\n";
+	{
+		alignas(std::max_align_t) unsigned char storage[256];
+		dyn_ref::AnyArena arena(storage, sizeof(storage), 1024);
+		{
+			auto text = dyn_ref::make_copy(arena, std::string("a string that does not fit in SSO"));
+			auto small = dyn_ref::make_copy(arena, 7);
+			std::cout << "string payload in arena: " << !text.is_inline() << ", int stays inline: " << small.is_inline() << " (1, 1)\n";
+			std::cout << "Arena used after string: " << (arena.used() >= sizeof(std::string)) << " (1=true)\n";
+
+			auto person = dyn_ref::make_move(arena, Person("Ivy", 31));
+			std::cout << "any_cast<Person> name: " << dyn_ref::any_cast<Person>(person)->name << " (expected Ivy)\n";
+
+			dyn_ref::Any heapCopy = text;
+			std::cout << "Copy leaves the arena: " << (heapCopy.payload != text.payload) << ", same value: " << heapCopy.equals(text) << " (1, 1)\n";
+
+			std::vector<dyn_ref::Any> many;
+			for (int i = 0; i < 100; ++i) {
+				many.push_back(dyn_ref::make_copy(arena, std::string(40, static_cast<char>('a' + i % 26))));
+			}
+			std::cout << "Arena grew past caller buffer: " << (arena.capacity() > sizeof(storage)) << " (1=true)\n";
+			std::cout << "many[27] first char: " << dyn_ref::any_cast<std::string>(many[27])->front() << " (expected b)\n";
+			std::cout << "Leaving scope runs destructors (watch for [Person] Destructor: Ivy)\n";
+		}
+		size_t capacityBefore = arena.capacity();
+		arena.reset();
+		std::cout << "After reset used: " << arena.used() << ", capacity kept: " << (arena.capacity() > 0 && arena.capacity() <= capacityBefore)
+		          << " (expected 0, 1)\n";
+		auto reused = dyn_ref::make_copy(arena, std::string("reuses the caller buffer after reset......"));
+		std::cout << "Reused payload in caller buffer: "
+		          << (static_cast<unsigned char*>(reused.payload) >= storage && static_cast<unsigned char*>(reused.payload) < storage + sizeof(storage))
+		          << " (1=true)\n";
+	}
+	std::cout << "\n";
+
 	std::cout << "========== All Any Tests Completed ==========\n";
 }
 
@@ -811,6 +1374,212 @@ void test_any_operations() {
 	}
 	std::cout << "\n";
 
+	// Test 7: Member access by name through Class
+	std::cout << "Test 7: Class::GetMemberValue and SetMemberValue\n";
+	std::cout << "-------------------------------------------------\n";
+	{
+		Person person("Lena", 21);
+		person.friends = {"Max"};
+		auto person_any = dyn_ref::make_ref(person);
+		const dyn_ref::Class* personClass = dyn_ref::GetType("Person")->AsClass();
+
+		auto age_any = personClass->GetMemberValue(person_any, "age");
+		std::cout << "GetMemberValue(\"age\"): " << *dyn_ref::any_cast<int>(age_any)
+		          << " (storage " << (int)age_any.storage() << ", 3=Ref)\n";
+		*dyn_ref::any_cast<int>(age_any) = 22;
+		std::cout << "Modified through the view, person.age: " << person.age << " (expected 22)\n";
+
+		bool success = personClass->SetMemberValue(person_any, "name", dyn_ref::make_copy(std::string("Mia")));
+		std::cout << "SetMemberValue(\"name\", \"Mia\"): " << (success ? "success" : "failed")
+		          << ", person.name: " << person.name << "\n";
+
+		success = personClass->SetMemberValue(person_any, "age", dyn_ref::make_copy(std::string("old")));
+		std::cout << "SetMemberValue(\"age\", std::string): " << (success ? "success" : "failed") << " (should fail)\n";
+
+		auto friends_any = personClass->GetMemberValue(person_any, "friends");
+		std::cout << "GetMemberValue(\"friends\") size: " << dyn_ref::any_cast<std::vector<std::string>>(friends_any)->size() << "\n";
+
+		auto const_person_any = dyn_ref::make_cref(person);
+		auto const_age_any = personClass->GetMemberValue(const_person_any, "age");
+		std::cout << "GetMemberValue on ConstRef instance, storage: " << (int)const_age_any.storage() << " (4=ConstRef)\n";
+		try {
+			personClass->SetMemberValue(const_person_any, "age", dyn_ref::make_copy(1));
+			std::cout << "ERROR: Should have thrown exception\n";
+		} catch (const std::exception& e) {
+			std::cout << "Expected error: " << e.what() << "\n";
+		}
+
+		const dyn_ref::Class* studentClass = dyn_ref::GetType("Student")->AsClass();
+		Student student("Nick", 20, 7L);
+		auto student_any = dyn_ref::make_ref(student);
+		try {
+			studentClass->GetMemberValue(student_any, "studentID");
+			std::cout << "ERROR: Should have thrown exception\n";
+		} catch (const std::exception& e) {
+			std::cout << "Expected error: " << e.what() << "\n";
+		}
+
+		dyn_ref::Register<Badge>()
+			.Register("Badge")
+			.Add("id", &Badge::id)
+			.Add("owner", &Badge::owner);
+		const dyn_ref::Class* badgeClass = dyn_ref::GetType<Badge>()->AsClass();
+		Badge badge{42, "Ann"};
+		auto badge_any = dyn_ref::make_ref(badge);
+		auto id_any = badgeClass->GetMemberValue(badge_any, "id");
+		std::cout << "Const member through a Ref instance: " << *dyn_ref::any_cast<int>(id_any) << ", storage "
+		          << (int)id_any.storage() << " (expected 42, 4=ConstRef)\n";
+		try {
+			badgeClass->SetMemberValue(badge_any, "id", dyn_ref::make_copy(7));
+			std::cout << "ERROR: Should have thrown exception\n";
+		} catch (const std::exception& e) {
+			std::cout << "Expected error: " << e.what() << "\n";
+		}
+	}
+	std::cout << "\n";
+
+	// Test 8: Binary serialization from Class metadata
+	std::cout << "Test 8: Binary Serialization via Class Metadata\n";
+	std::cout << "-----------------------------------------------\n";
+	{
+		namespace sta_ref = my_reflect::static_refl;
+
+		dyn_ref::Register<Reading>()
+			.Register("Reading")
+			.Add("sensor", &Reading::sensor)
+			.Add("value", &Reading::value)
+			.Add("color", &Reading::color)
+			.Add("samples", &Reading::samples)
+			.Add("tags", &Reading::tags);
+
+		Reading reading{3, 0.5, Color::green, {4.0f, 5.0f}, {"x"}};
+		auto bytes = dyn_ref::Serialize(dyn_ref::make_cref(reading));
+		std::cout << "Reading matches static encoder: " << (bytes == sta_ref::utils::to_binary(reading)) << " (1=true)\n";
+
+		// sensor | value+color (adjacent, one memcpy) | samples | tags
+		const auto& program = dyn_ref::GetBinaryProgram(*dyn_ref::GetType<Reading>()->AsClass(), &reading);
+		std::cout << "Reading program ops: " << program.GetOps().size() << " (expected 4)\n";
+
+		Reading decoded;
+		auto decoded_any = dyn_ref::make_ref(decoded);
+		dyn_ref::Deserialize(decoded_any, bytes);
+		std::cout << "Decoded reading: " << decoded.sensor << ", " << decoded.value << ", "
+		          << decoded.samples.size() << " samples, tag " << decoded.tags[0] << " (expected 3, 0.5, 2 samples, tag x)\n";
+
+		Person person("Ivy", 33);
+		person.friends = {"Jon", "Kim"};
+		person.scores = {{"art", 88}};
+		auto personBytes = dyn_ref::Serialize(dyn_ref::make_cref(person));
+		std::cout << "Person matches static encoder: " << (personBytes == sta_ref::utils::to_binary(person)) << " (1=true)\n";
+
+		Person restored("", 0);
+		auto restored_any = dyn_ref::make_ref(restored);
+		dyn_ref::Deserialize(restored_any, personBytes);
+		std::cout << "Restored person: " << restored.name << ", " << restored.age << ", "
+		          << restored.friends.size() << " friends, art=" << restored.scores["art"]
+		          << " (expected Ivy, 33, 2 friends, art=88)\n";
+
+		dyn_ref::Register<Shape>().Register("Shape").Add("sides", &Shape::sides);
+		dyn_ref::Register<Labeled>().Register("Labeled").Add("label", &Labeled::label);
+		dyn_ref::Register<Tile>()
+			.Register("Tile")
+			.AddBaseClass<Labeled>()
+			.AddBaseClass<Shape>()
+			.Add("size", &Tile::size);
+		Tile tile(2.5);
+		tile.label = "floor";
+		tile.sides = 4;
+		Tile tileCopy(0.0);
+		auto tileCopy_any = dyn_ref::make_ref(tileCopy);
+		dyn_ref::Deserialize(tileCopy_any, dyn_ref::Serialize(dyn_ref::make_cref(tile)));
+		std::cout << "Polymorphic Tile round trip: " << tileCopy.label << ", " << tileCopy.sides << ", "
+		          << tileCopy.size << " (expected floor, 4, 2.5)\n";
+
+		// Opaque is never registered, so Holder's program cannot encode it
+		dyn_ref::Register<Holder>()
+			.Register("Holder")
+			.Add("id", &Holder::id)
+			.Add("opaque", &Holder::opaque);
+		Holder holder;
+		try {
+			dyn_ref::Serialize(dyn_ref::make_cref(holder));
+			std::cout << "ERROR: Should have thrown exception\n";
+		} catch (const std::exception& e) {
+			std::cout << "Expected error: " << e.what() << "\n";
+		}
+
+		// A codec registered with the serializer turns Opaque into a leaf value
+		dyn_ref::BinaryCodec opaqueCodec;
+		opaqueCodec.encode = [](const void* value, dyn_ref::BinaryWriter& out) {
+			out.write(&static_cast<const Opaque*>(value)->hidden, sizeof(int));
+		};
+		opaqueCodec.decode = [](void* value, dyn_ref::BinaryReader& in) {
+			in.read(&static_cast<Opaque*>(value)->hidden, sizeof(int));
+		};
+		dyn_ref::RegisterBinaryCodec(dyn_ref::GetType<Opaque>(), opaqueCodec);
+		holder = Holder{5, Opaque{9}};
+		Holder holderCopy;
+		auto holderCopy_any = dyn_ref::make_ref(holderCopy);
+		dyn_ref::Deserialize(holderCopy_any, dyn_ref::Serialize(dyn_ref::make_cref(holder)));
+		std::cout << "Holder with an Opaque codec: " << holderCopy.id << ", " << holderCopy.opaque.hidden
+		          << " (expected 5, 9)\n";
+
+		Student student("Nick", 20, 7L);
+		try {
+			dyn_ref::Serialize(dyn_ref::make_cref(student));
+			std::cout << "ERROR: Should have thrown exception\n";
+		} catch (const std::exception& e) {
+			std::cout << "Expected error: " << e.what() << "\n";
+		}
+	}
+	std::cout << "\n";
+
+	// Test 9: Enum lookup tables
+	std::cout << "Test 9: Enum Lookup Tables\n";
+	std::cout << "--------------------------\n";
+	{
+		dyn_ref::Register<HttpStatus>()
+			.Register("HttpStatus")
+			.Add("ok", HttpStatus::ok)
+			.Add("created", HttpStatus::created)
+			.Add("notFound", HttpStatus::notFound)
+			.Add("teapot", HttpStatus::teapot)
+			.Add("unavailable", HttpStatus::unavailable);
+
+		const auto* colorEnum = dyn_ref::GetType("Color")->AsEnum();
+		const auto* statusEnum = dyn_ref::GetType("HttpStatus")->AsEnum();
+		std::cout << "Color uses dense table: " << colorEnum->IsDense() << " (1=true)\n";
+		std::cout << "HttpStatus uses dense table: " << statusEnum->IsDense() << " (expected 0)\n";
+
+		std::cout << "Color FindName(2): " << colorEnum->FindName(2) << " (expected blue)\n";
+		std::cout << "Color FindName(3) empty: " << colorEnum->FindName(3).empty() << " (1=true)\n";
+		std::cout << "Color FindName(-1) empty: " << colorEnum->FindName(-1).empty() << " (1=true)\n";
+		std::cout << "HttpStatus FindName(418): " << statusEnum->FindName(418) << " (expected teapot)\n";
+		std::cout << "HttpStatus FindName(300) empty: " << statusEnum->FindName(300).empty() << " (1=true)\n";
+		std::cout << "HttpStatus FindValue(\"notFound\"): " << statusEnum->FindValue("notFound").value_or(-1)
+		          << " (expected 404)\n";
+		std::cout << "HttpStatus FindValue(\"missing\") empty: " << !statusEnum->FindValue("missing").has_value()
+		          << " (1=true)\n";
+
+		HttpStatus status = HttpStatus::ok;
+		auto status_any = dyn_ref::make_ref(status);
+		std::string_view name = statusEnum->GetNameView(status_any);
+		std::cout << "GetNameView: " << name << ", points into the Enum: "
+		          << (name.data() == statusEnum->GetItems()[0].name_.data()) << " (expected ok, 1)\n";
+		statusEnum->SetByName(status_any, std::string_view("unavailable"));
+		std::cout << "After SetByName: " << static_cast<int>(status) << " (expected 503)\n";
+		std::cout << "GetName after set: " << statusEnum->GetName(status_any).value_or("unknown")
+		          << " (expected unavailable)\n";
+
+		// Value tables are rebuilt by the first lookup after an add
+		auto& levels = dyn_ref::Register<Level>().Register("Level").Add("low", Level::low).Add("mid", Level::mid);
+		const auto* levelEnum = levels.GetInfo().AsEnum();
+		std::cout << "Level FindName(2) before add empty: " << levelEnum->FindName(2).empty() << " (1=true)\n";
+		levels.Add("high", Level::high);
+		std::cout << "Level FindName(2) after add: " << levelEnum->FindName(2) << " (expected high)\n";
+	}
+	std::cout << "\n";
+
 	std::cout << "========== All Any Operations Tests Completed ==========\n";
 }
 
@@ -918,7 +1687,7 @@ void test_container_operations() {
 		const auto* personClass = dyn_ref::GetType("Person")->AsClass();
 		if (personClass) {
 			// Find the 'friends' container
-			for (const auto& container : personClass->memberContainers_) {
+			for (const auto& container : personClass->GetMemberContainers()) {
 				if (container.name_ == "friends") {
 					std::cout << "Found 'friends' container\n";
 
@@ -949,6 +1718,288 @@ void test_container_operations() {
 	}
 	std::cout << "\n";
 
+	// Test 5: Cursor and ForEach iteration
+	std::cout << "Test 5: Cursor and ForEach (no Any per element)\n";
+	std::cout << "------------------------------------------------\n";
+	{
+		std::vector<int> numbers = {1, 2, 3, 4};
+		auto vecInfo = dyn_ref::MemberContainer::Create<std::vector<int>>("numbers");
+		auto numbers_any = dyn_ref::make_ref(numbers);
+		int sum = 0;
+		size_t visited = dyn_ref::container_ops::ForEach(vecInfo, numbers_any, [&](const dyn_ref::ContainerElement& element) {
+			sum += *dyn_ref::view_cast<int>(element.value);
+			*static_cast<int*>(element.value.payload) *= 10;
+		});
+		std::cout << "ForEach visited " << visited << ", sum " << sum << ", numbers[3] now " << numbers[3]
+		          << " (expected 4, 10, 40)\n";
+
+		std::set<std::string> tags = {"b", "a", "c"};
+		auto setInfo = dyn_ref::MemberContainer::Create<std::set<std::string>>("tags");
+		auto tags_any = dyn_ref::make_ref(tags);
+		std::cout << "Set via cursor:";
+		for (auto cursor = dyn_ref::container_ops::Begin(setInfo, tags_any); cursor.valid;
+		     dyn_ref::container_ops::Next(setInfo, cursor)) {
+			std::cout << " " << *dyn_ref::view_cast<std::string>(cursor.element.value)
+			          << (cursor.element.value.isConst ? "(ro)" : "");
+		}
+		std::cout << " (expected a(ro) b(ro) c(ro))\n";
+
+		// Reusing a cursor that last walked a vector must not step the set as contiguous memory
+		dyn_ref::ContainerCursor reused = dyn_ref::container_ops::Begin(vecInfo, numbers_any);
+		setInfo.ops_.begin(tags_any, reused);
+		size_t setCount = 0;
+		for (; reused.valid; dyn_ref::container_ops::Next(setInfo, reused)) {
+			++setCount;
+		}
+		std::cout << "Reused cursor over set: " << setCount << " elements, stride " << reused.stride
+		          << " (expected 3, stride 0)\n";
+
+		visited = dyn_ref::container_ops::ForEach(vecInfo, numbers_any, [](const dyn_ref::ContainerElement& element) {
+			return *dyn_ref::view_cast<int>(element.value) < 20;
+		});
+		std::cout << "Vector ForEach stopped after " << visited << " (expected 2)\n";
+
+		std::map<std::string, int> stock = {{"apple", 3}, {"pear", 0}, {"plum", 7}};
+		auto mapInfo = dyn_ref::MemberContainer::Create<std::map<std::string, int>>("stock");
+		auto stock_cref = dyn_ref::make_cref(stock);
+		std::cout << "Map until first empty:";
+		visited = dyn_ref::container_ops::ForEach(mapInfo, stock_cref, [](const dyn_ref::ContainerElement& element) {
+			std::cout << " " << *dyn_ref::view_cast<std::string>(element.key) << "=" << *dyn_ref::view_cast<int>(element.value);
+			return *dyn_ref::view_cast<int>(element.value) != 0;
+		});
+		std::cout << " (expected apple=3 pear=0, stopped after " << visited << " of 3)\n";
+		std::cout << "Values of a ConstRef map are read-only: "
+		          << dyn_ref::container_ops::Begin(mapInfo, stock_cref).element.value.isConst << " (1=true)\n";
+
+		std::vector<int> empty;
+		auto empty_any = dyn_ref::make_ref(empty);
+		std::cout << "Cursor on empty vector is valid: " << dyn_ref::container_ops::Begin(vecInfo, empty_any).valid
+		          << " (expected 0)\n";
+		try {
+			dyn_ref::container_ops::ForEach(vecInfo, tags_any, [](const dyn_ref::ContainerElement&) {});
+			std::cout << "ERROR: Should have thrown exception\n";
+		} catch (const std::exception& e) {
+			std::cout << "Expected error: " << e.what() << "\n";
+		}
+	}
+	std::cout << "\n";
+
+	// Test 6: Bulk and contiguous vector access
+	std::cout << "Test 6: Bulk and Contiguous Vector Access\n";
+	std::cout << "-----------------------------------------\n";
+	{
+		std::vector<double> samples;
+		auto info = dyn_ref::MemberContainer::Create<std::vector<double>>("samples");
+		auto samples_any = dyn_ref::make_ref(samples);
+
+		dyn_ref::container_ops::Reserve(info, samples_any, 64);
+		std::cout << "Capacity after Reserve(64) >= 64: " << (samples.capacity() >= 64) << " (1=true)\n";
+
+		const double first[] = {1.5, 2.5, 3.5};
+		const double more[] = {4.5, 5.5};
+		dyn_ref::container_ops::AssignRange(info, samples_any, first, 3);
+		dyn_ref::container_ops::AppendRange(info, samples_any, more, 2);
+		std::cout << "After AssignRange + AppendRange: size " << samples.size() << ", last " << samples.back()
+		          << " (expected 5, 5.5)\n";
+
+		const int wrong[] = {1, 2};
+		std::cout << "AppendRange of int into vector<double>: "
+		          << dyn_ref::container_ops::AppendRange(info, samples_any, wrong, 2) << " (expected 0)\n";
+
+		dyn_ref::container_ops::Resize(info, samples_any, 8);
+		dyn_ref::ContiguousBlock block = dyn_ref::container_ops::Contiguous(info, samples_any);
+		std::cout << "Block: count " << block.count << ", stride " << block.stride << ", element type "
+		          << block.elementType->GetName() << ", same data " << (block.data == samples.data()) << "\n";
+		for (size_t i = 0; i < block.count; ++i) {
+			*reinterpret_cast<double*>(static_cast<char*>(block.data) + i * block.stride) = static_cast<double>(i);
+		}
+		std::cout << "samples[7] written through block: " << samples[7] << " (expected 7)\n";
+		std::cout << "Block of a ConstRef is read-only: "
+		          << dyn_ref::container_ops::Contiguous(info, dyn_ref::make_cref(samples)).isConst << " (1=true)\n";
+
+		auto stringsInfo = dyn_ref::MemberContainer::Create<std::vector<std::string>>("strings");
+		std::vector<std::string> strings;
+		auto strings_any = dyn_ref::make_ref(strings);
+		const std::string words[] = {"x", "y"};
+		dyn_ref::container_ops::AppendRange(stringsInfo, strings_any, words, 2);
+		std::cout << "AppendRange of strings: " << strings.size() << " (expected 2)\n";
+		dyn_ref::container_ops::AppendRange(stringsInfo, strings_any, strings.data(), strings.size());
+		std::cout << "AppendRange of itself: " << strings.size() << ", " << strings[2] << strings[3]
+		          << " (expected 4, xy)\n";
+		dyn_ref::container_ops::AssignRange(stringsInfo, strings_any, strings.data() + 1, 2);
+		std::cout << "AssignRange from its own elements: " << strings.size() << ", " << strings[0] << strings[1]
+		          << " (expected 2, yx)\n";
+
+		// A full vector reallocates on append; the source must be read before the old buffer goes away
+		std::vector<double> full = {1.0, 2.0, 3.0};
+		full.shrink_to_fit();
+		auto full_any = dyn_ref::make_ref(full);
+		dyn_ref::container_ops::AppendRange(info, full_any, full.data(), full.size());
+		std::cout << "AppendRange of a full vector into itself: " << full.size() << ", " << full[3] << full[4]
+		          << full[5] << " (expected 6, 123)\n";
+
+		auto dequeInfo = dyn_ref::MemberContainer::Create<std::deque<int>>("queue");
+		std::deque<int> queue = {1, 2, 3, 4};
+		auto queue_any = dyn_ref::make_ref(queue);
+		dyn_ref::container_ops::AssignRange(dequeInfo, queue_any, &queue[2], 2);
+		std::cout << "AssignRange of a deque from its own tail: " << queue.size() << ", " << queue[0] << queue[1]
+		          << " (expected 2, 34)\n";
+		try {
+			dyn_ref::container_ops::Contiguous(stringsInfo, strings_any);
+			std::cout << "ERROR: Should have thrown exception\n";
+		} catch (const std::exception& e) {
+			std::cout << "Expected error: " << e.what() << "\n";
+		}
+	}
+	std::cout << "\n";
+
+	// Test 7: unordered_map, unordered_set, deque and array
+	std::cout << "Test 7: Hashed, Deque and Array Containers\n";
+	std::cout << "------------------------------------------\n";
+	{
+		namespace sta_ref = my_reflect::static_refl;
+
+		dyn_ref::Register<Warehouse>()
+			.Register("Warehouse")
+			.Add("stock", &Warehouse::stock)
+			.Add("bins", &Warehouse::bins)
+			.Add("log", &Warehouse::log)
+			.Add("origin", &Warehouse::origin)
+			.Add("labels", &Warehouse::labels);
+		const dyn_ref::Class* warehouseClass = dyn_ref::GetType<Warehouse>()->AsClass();
+		const dyn_ref::MemberContainer* stockInfo = warehouseClass->FindContainer("stock");
+		const dyn_ref::MemberContainer* binsInfo = warehouseClass->FindContainer("bins");
+		const dyn_ref::MemberContainer* logInfo = warehouseClass->FindContainer("log");
+		const dyn_ref::MemberContainer* originInfo = warehouseClass->FindContainer("origin");
+		std::cout << "Kinds: " << (stockInfo->kind_ == sta_ref::ContainerKind::UnorderedMap)
+		          << (binsInfo->kind_ == sta_ref::ContainerKind::UnorderedSet)
+		          << (logInfo->kind_ == sta_ref::ContainerKind::Deque)
+		          << (originInfo->kind_ == sta_ref::ContainerKind::Array) << " (expected 1111)\n";
+
+		Warehouse warehouse;
+		auto stock_any = dyn_ref::make_ref(warehouse.stock);
+		auto bolts = dyn_ref::make_copy(std::string("bolts"));
+		dyn_ref::container_ops::InsertKV(*stockInfo, stock_any, bolts, dyn_ref::make_copy(40));
+		std::cout << "unordered_map contains bolts: " << dyn_ref::container_ops::ContainsKey(*stockInfo, stock_any, bolts)
+		          << ", value " << *dyn_ref::any_cast<int>(dyn_ref::container_ops::GetValue(*stockInfo, stock_any, bolts))
+		          << " (expected 1, 40)\n";
+
+		auto bins_any = dyn_ref::make_ref(warehouse.bins);
+		dyn_ref::container_ops::Push(*binsInfo, bins_any, dyn_ref::make_copy(12));
+		dyn_ref::container_ops::Push(*binsInfo, bins_any, dyn_ref::make_copy(12));
+		std::cout << "unordered_set size after pushing 12 twice: " << dyn_ref::container_ops::Size(*binsInfo, bins_any)
+		          << ", contains 12: " << dyn_ref::container_ops::ContainsKey(*binsInfo, bins_any, dyn_ref::make_copy(12))
+		          << " (expected 1, 1)\n";
+
+		auto log_any = dyn_ref::make_ref(warehouse.log);
+		const std::string entries[] = {"open", "count", "close"};
+		dyn_ref::container_ops::AppendRange(*logInfo, log_any, entries, 3);
+		std::cout << "deque via cursor:";
+		for (auto cursor = dyn_ref::container_ops::Begin(*logInfo, log_any); cursor.valid;
+		     dyn_ref::container_ops::Next(*logInfo, cursor)) {
+			std::cout << " " << *dyn_ref::view_cast<std::string>(cursor.element.value);
+		}
+		std::cout << ", at(1) " << *dyn_ref::any_cast<std::string>(dyn_ref::container_ops::At(*logInfo, log_any, 1))
+		          << " (expected open count close, at(1) count)\n";
+
+		auto origin_any = dyn_ref::make_ref(warehouse.origin);
+		dyn_ref::ContiguousBlock block = dyn_ref::container_ops::Contiguous(*originInfo, origin_any);
+		static_cast<double*>(block.data)[2] = 9.5;
+		double originSum = 0;
+		dyn_ref::container_ops::ForEach(*originInfo, origin_any, [&](const dyn_ref::ContainerElement& element) {
+			originSum += *dyn_ref::view_cast<double>(element.value);
+		});
+		std::cout << "array block count " << block.count << ", sum " << originSum << " (expected 3, 9.5)\n";
+		try {
+			dyn_ref::container_ops::Clear(*originInfo, origin_any);
+			std::cout << "ERROR: Should have thrown exception\n";
+		} catch (const std::exception& e) {
+			std::cout << "Expected error: " << e.what() << "\n";
+		}
+
+		warehouse.labels = {"north", "south"};
+		auto bytes = dyn_ref::Serialize(dyn_ref::make_cref(warehouse));
+		std::cout << "Warehouse matches static encoder: " << (bytes == sta_ref::utils::to_binary(warehouse)) << " (1=true)\n";
+		Warehouse decoded;
+		auto decoded_any = dyn_ref::make_ref(decoded);
+		dyn_ref::Deserialize(decoded_any, bytes);
+		std::cout << "Binary round trip: " << (decoded.stock == warehouse.stock && decoded.bins == warehouse.bins
+		          && decoded.log == warehouse.log && decoded.origin == warehouse.origin && decoded.labels == warehouse.labels)
+		          << " (1=true)\n";
+
+		Warehouse fromJson;
+		sta_ref::utils::from_json(fromJson, sta_ref::utils::to_json(warehouse));
+		std::cout << "JSON round trip: " << (fromJson.stock == warehouse.stock && fromJson.bins == warehouse.bins
+		          && fromJson.log == warehouse.log && fromJson.origin == warehouse.origin && fromJson.labels == warehouse.labels)
+		          << " (1=true)\n";
+		try {
+			sta_ref::utils::from_json(fromJson, "{\"origin\": [1, 2]}");
+			std::cout << "ERROR: accepted a short array\n";
+		} catch (const std::runtime_error& e) {
+			std::cout << "Rejected: " << e.what() << "\n";
+		}
+	}
+	std::cout << "\n";
+
+	// Test 8: Move-based inserts
+	std::cout << "Test 8: PushMove, EmplaceKV and TryEmplace\n";
+	std::cout << "------------------------------------------\n";
+	{
+		auto vecInfo = dyn_ref::MemberContainer::Create<std::vector<Tracked>>("items");
+		std::vector<Tracked> items;
+		items.reserve(4);
+		auto items_any = dyn_ref::make_ref(items);
+
+		auto owned = dyn_ref::make_copy(Tracked());
+		Tracked::copies = 0;
+		Tracked::moves = 0;
+		dyn_ref::container_ops::PushMove(vecInfo, items_any, std::move(owned));
+		std::cout << "PushMove of an owned value: " << Tracked::copies << " copies, " << Tracked::moves
+		          << " moves, source empty " << owned.empty() << " (expected 0, 1, 1)\n";
+
+		Tracked local;
+		auto view = dyn_ref::make_ref(local);
+		dyn_ref::container_ops::PushMove(vecInfo, items_any, std::move(view));
+		std::cout << "PushMove of a Ref: " << Tracked::copies << " copies, view kept " << !view.empty()
+		          << " (expected 1, 1)\n";
+
+		auto number = dyn_ref::make_copy(5);
+		std::cout << "PushMove of an int: " << dyn_ref::container_ops::PushMove(vecInfo, items_any, std::move(number))
+		          << ", int kept " << !number.empty() << " (expected 0, 1)\n";
+
+		auto setInfo = dyn_ref::MemberContainer::Create<std::set<std::string>>("names");
+		std::set<std::string> names = {"kept"};
+		auto names_any = dyn_ref::make_ref(names);
+		auto duplicate = dyn_ref::make_copy(std::string("kept"));
+		dyn_ref::container_ops::PushMove(setInfo, names_any, std::move(duplicate));
+		std::cout << "PushMove of a duplicate into a set: size " << names.size() << ", value kept "
+		          << (!duplicate.empty() && *dyn_ref::any_cast<std::string>(duplicate) == "kept") << " (expected 1, 1)\n";
+
+		auto mapInfo = dyn_ref::MemberContainer::Create<std::map<std::string, Tracked>>("byName");
+		std::map<std::string, Tracked> byName;
+		auto byName_any = dyn_ref::make_ref(byName);
+		auto key = dyn_ref::make_copy(std::string("first"));
+		auto value = dyn_ref::make_copy(Tracked());
+		Tracked::copies = 0;
+		dyn_ref::container_ops::EmplaceKV(mapInfo, byName_any, std::move(key), std::move(value));
+		std::cout << "EmplaceKV: " << Tracked::copies << " copies, size " << byName.size() << " (expected 0, 1)\n";
+
+		auto sameKey = dyn_ref::make_copy(std::string("first"));
+		auto other = dyn_ref::make_copy(Tracked());
+		bool inserted = dyn_ref::container_ops::TryEmplace(mapInfo, byName_any, std::move(sameKey), std::move(other));
+		std::cout << "TryEmplace on existing key: " << inserted << ", value kept " << !other.empty()
+		          << " (expected 0, 1)\n";
+		auto newKey = dyn_ref::make_copy(std::string("second"));
+		Tracked::copies = 0;
+		inserted = dyn_ref::container_ops::TryEmplace(mapInfo, byName_any, std::move(newKey), std::move(other));
+		std::cout << "TryEmplace on new key: " << inserted << ", value moved " << other.empty() << ", copies "
+		          << Tracked::copies << " (expected 1, 1, 0)\n";
+
+		dyn_ref::container_ops::InsertKV(mapInfo, byName_any, dyn_ref::make_copy(std::string("third")), dyn_ref::make_copy(Tracked()));
+		std::cout << "InsertKV still copies: " << (Tracked::copies > 0) << " (1=true)\n";
+	}
+	std::cout << "\n";
+
 	std::cout << "========== All Container Operations Tests Completed ==========\n";
 }
 
@@ -971,7 +2022,7 @@ void test_function_invoke() {
 
 	// Find getName function
 	const dyn_ref::MemberFunction* getName_func = nullptr;
-	for (const auto& func : personClass->memberFunctions_) {
+	for (const auto& func : personClass->GetMemberFunctions()) {
 		if (func.name_ == "getName") {
 			getName_func = &func;
 			break;
@@ -993,7 +2044,7 @@ void test_function_invoke() {
 	std::cout << "---------------------------------------------------\n";
 
 	const dyn_ref::MemberFunction* setName_func = nullptr;
-	for (const auto& func : personClass->memberFunctions_) {
+	for (const auto& func : personClass->GetMemberFunctions()) {
 		if (func.name_ == "setName") {
 			setName_func = &func;
 			break;
@@ -1015,7 +2066,7 @@ void test_function_invoke() {
 	std::cout << "---------------------------------------------------\n";
 
 	const dyn_ref::MemberFunction* getAge_func = nullptr;
-	for (const auto& func : personClass->memberFunctions_) {
+	for (const auto& func : personClass->GetMemberFunctions()) {
 		if (func.name_ == "getAge") {
 			getAge_func = &func;
 			break;
@@ -1037,7 +2088,7 @@ void test_function_invoke() {
 	std::cout << "---------------------------------------------------------\n";
 
 	const dyn_ref::MemberFunction* speak_func = nullptr;
-	for (const auto& func : personClass->memberFunctions_) {
+	for (const auto& func : personClass->GetMemberFunctions()) {
 		if (func.name_ == "speak") {
 			speak_func = &func;
 			break;
@@ -1056,6 +2107,68 @@ void test_function_invoke() {
 	}
 	std::cout << "\n";
 
+	// Test 5: Invoke with non-owning argument views
+	std::cout << "Test 5: Invoke with argument views (no boxing)\n";
+	std::cout << "-----------------------------------------------\n";
+
+	if (setName_func && getName_func) {
+		std::string viewName = "Viewed";
+		std::array<dyn_ref::AnyView, 1> views{dyn_ref::make_view(viewName)};
+		setName_func->Invoke(p1_any, dyn_ref::ArgSpan(views));
+		std::cout << "After setName via ArgSpan, name is now: " << p1.getName() << "\n";
+
+		int wrongType = 3;
+		std::array<dyn_ref::AnyView, 1> badViews{dyn_ref::make_view(wrongType)};
+		try {
+			setName_func->Invoke(p1_any, dyn_ref::ArgSpan(badViews));
+			std::cout << "ERROR: Should have thrown exception\n";
+		} catch (const std::exception& e) {
+			std::cout << "Expected error: " << e.what() << "\n";
+		}
+	}
+	std::cout << "\n";
+
+	// Test 6: Precompiled call plans
+	std::cout << "Test 6: CallPlan (types validated once)\n";
+	std::cout << "---------------------------------------\n";
+
+	if (setName_func && getAge_func && speak_func) {
+		const dyn_ref::Type* personType = dyn_ref::GetType<Person>();
+		dyn_ref::CallPlan setNamePlan(*setName_func, personType, {dyn_ref::GetType<std::string>()});
+		std::string planned = "Planned";
+		setNamePlan(p1_any, dyn_ref::make_view(planned));
+		std::cout << "After setName via CallPlan: " << p1.getName() << " (expected Planned)\n";
+
+		dyn_ref::CallPlan getAgePlan(*getAge_func, personType, {});
+		std::cout << "getAge via CallPlan: " << *dyn_ref::any_cast<int>(getAgePlan(p1_any)) << " (expected " << p1.getAge() << ")\n";
+
+		std::string words = "Hi";
+		int duration = 2;
+		dyn_ref::CallPlan speakPlan(*speak_func, personType, {dyn_ref::GetType<std::string>(), dyn_ref::GetType<int>()});
+		std::cout << "speak via CallPlan returns empty Any: " << speakPlan(p1_any, dyn_ref::make_view(words), dyn_ref::make_view(duration)).empty()
+		          << " (1=true)\n";
+
+		try {
+			dyn_ref::CallPlan bad(*setName_func, personType, {dyn_ref::GetType<int>()});
+			std::cout << "ERROR: Should have thrown exception\n";
+		} catch (const std::exception& e) {
+			std::cout << "Expected error: " << e.what() << "\n";
+		}
+		try {
+			dyn_ref::CallPlan bad(*getAge_func, dyn_ref::GetType<int>(), {});
+			std::cout << "ERROR: Should have thrown exception\n";
+		} catch (const std::exception& e) {
+			std::cout << "Expected error: " << e.what() << "\n";
+		}
+		try {
+			dyn_ref::CallPlan bad(*speak_func, personType, {dyn_ref::GetType<std::string>()});
+			std::cout << "ERROR: Should have thrown exception\n";
+		} catch (const std::exception& e) {
+			std::cout << "Expected error: " << e.what() << "\n";
+		}
+	}
+	std::cout << "\n";
+
 	std::cout << "========== All Function Invocation Tests Completed ==========\n";
 }
 
@@ -1162,6 +2275,130 @@ void test_any_invoke() {
 	}
 	std::cout << "\n";
 
+	// Test 8: Return values are not copied
+	std::cout << "Test 8: Return values are not copied\n";
+	std::cout << "------------------------------------\n";
+	{
+		dyn_ref::Register<Tracked>()
+			.Register("Tracked");
+		dyn_ref::Register<TrackedFactory>()
+			.Register("TrackedFactory")
+			.Add("make", &TrackedFactory::make)
+			.Add("held", &TrackedFactory::held)
+			.Add("mutableHeld", &TrackedFactory::mutableHeld);
+
+		TrackedFactory factory;
+		auto factory_any = dyn_ref::make_ref(factory);
+		Tracked::copies = 0;
+		Tracked::moves = 0;
+
+		auto made = factory_any.invoke("make");
+		std::cout << "By-value return: " << Tracked::copies << " copies, " << Tracked::moves << " moves (expected 0, 0)\n";
+		std::cout << "Owned result: " << (made.storage() == dyn_ref::Any::storage_type::Move) << " (1=true)\n";
+
+		auto held = factory_any.invoke("held");
+		std::cout << "const& return is a ConstRef view of the member: "
+		          << (held.storage() == dyn_ref::Any::storage_type::ConstRef && held.payload == &factory.kept) << " (1=true)\n";
+		auto mutableHeld = factory_any.invoke("mutableHeld");
+		std::cout << "& return is a Ref view: " << (mutableHeld.storage() == dyn_ref::Any::storage_type::Ref) << " (1=true)\n";
+		std::cout << "Copies after reference returns: " << Tracked::copies << " (expected 0)\n";
+
+		Person person("Quinn", 44);
+		auto person_any = dyn_ref::make_ref(person);
+		auto name = person_any.invoke("getName");
+		std::cout << "getName() aliases person.name: " << (name.payload == &person.name) << " (1=true)\n";
+	}
+	std::cout << "\n";
+
+	// Test 9: Batched invocation
+	std::cout << "Test 9: InvokeBatch over many instances\n";
+	std::cout << "---------------------------------------\n";
+	{
+		dyn_ref::Register<Tally>()
+			.Register("Tally")
+			.Add("add", &Tally::add)
+			.Add("get", &Tally::get);
+		const dyn_ref::MemberFunction* add = dyn_ref::GetType<Tally>()->AsClass()->FindFunction("add");
+
+		std::vector<Tally> tallies(10000);
+		std::vector<dyn_ref::Any> instances;
+		instances.reserve(tallies.size());
+		for (Tally& tally : tallies) {
+			instances.push_back(dyn_ref::make_ref(tally));
+		}
+
+		int delta = 2;
+		std::array<dyn_ref::AnyView, 1> args{dyn_ref::make_view(delta)};
+		std::vector<dyn_ref::Any> results;
+		add->InvokeBatch(instances, dyn_ref::ArgSpan(args), &results);
+		std::cout << "Results: " << results.size() << ", last = " << *dyn_ref::any_cast<int>(results.back()) << " (expected 10000, 2)\n";
+
+		dyn_ref::ThreadPool pool(3);
+		dyn_ref::BatchOptions options;
+		options.pool = &pool;
+		options.minChunk = 256;
+		add->InvokeBatch(instances, dyn_ref::ArgSpan(args), nullptr, options);
+		bool allFour = true;
+		for (const Tally& tally : tallies) {
+			allFour = allFour && tally.total == 4;
+		}
+		std::cout << "Every instance updated once by the pool: " << allFour << " (1=true)\n";
+
+		// A ParallelFor issued from inside a chunk runs inline instead of waiting on the outer call
+		std::atomic<size_t> innerItems{0};
+		pool.ParallelFor(8, 1, [&](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; ++i) {
+				pool.ParallelFor(100, 10, [&](size_t innerBegin, size_t innerEnd) {
+					innerItems += innerEnd - innerBegin;
+				});
+			}
+		});
+		std::cout << "Nested ParallelFor items: " << innerItems.load() << " (expected 800)\n";
+
+		Person stranger("Stranger", 1);
+		instances[5000] = dyn_ref::make_ref(stranger);
+		try {
+			add->InvokeBatch(instances, dyn_ref::ArgSpan(args), nullptr, options);
+			std::cout << "ERROR: Should have thrown exception\n";
+		} catch (const std::exception& e) {
+			std::cout << "Expected error: " << e.what() << "\n";
+		}
+		std::cout << "Nothing ran before the error: " << (tallies[0].total == 4) << " (1=true)\n";
+		instances[5000] = dyn_ref::make_ref(tallies[5000]);
+
+		// A non-const function is refused through a const view, in a batch and in a single call
+		instances[7000] = dyn_ref::make_cref(tallies[7000]);
+		try {
+			add->InvokeBatch(instances, dyn_ref::ArgSpan(args), nullptr, options);
+			std::cout << "ERROR: Should have thrown exception\n";
+		} catch (const std::exception& e) {
+			std::cout << "Expected error: " << e.what() << "\n";
+		}
+		std::cout << "Nothing ran before the const error: " << (tallies[0].total == 4) << " (1=true)\n";
+		try {
+			add->Invoke(instances[7000], dyn_ref::ArgSpan(args));
+			std::cout << "ERROR: Should have thrown exception\n";
+		} catch (const std::exception& e) {
+			std::cout << "Expected error: " << e.what() << "\n";
+		}
+		const dyn_ref::MemberFunction* get = dyn_ref::GetType<Tally>()->AsClass()->FindFunction("get");
+		std::vector<dyn_ref::Any> totals;
+		get->InvokeBatch(instances, dyn_ref::ArgSpan(), &totals, options);
+		std::cout << "Const function over const views: " << *dyn_ref::any_cast<int>(totals[7000])
+		          << " (expected 4)\n";
+		instances[7000] = dyn_ref::make_ref(tallies[7000]);
+
+		std::string notAnInt = "two";
+		std::array<dyn_ref::AnyView, 1> badArgs{dyn_ref::make_view(notAnInt)};
+		try {
+			add->InvokeBatch(instances, dyn_ref::ArgSpan(badArgs));
+			std::cout << "ERROR: Should have thrown exception\n";
+		} catch (const std::exception& e) {
+			std::cout << "Expected error: " << e.what() << "\n";
+		}
+	}
+	std::cout << "\n";
+
 	std::cout << "========== All Any::invoke Tests Completed ==========\n";
 }
 
@@ -1251,6 +2488,101 @@ void test_static_variable_access() {
 	std::cout << "========== All Static Variable Access Tests Completed ==========\n";
 }
 
+void test_json_serialization() {
+	namespace sta_ref = my_reflect::static_refl;
+
+	std::cout << "\n========== JSON Serialization Tests ==========\n\n";
+
+	// Test 1: Write a reflected struct
+	std::cout << "Test 1: Write Reflected Struct\n";
+	std::cout << "------------------------------\n";
+	Reading reading{5, 1.25, Color::green, {0.5f, 2.0f}, {"line\n2", "quote\""}};
+	std::string json = sta_ref::utils::to_json(reading);
+	std::cout << json << "\n";
+	std::cout << "\n";
+
+	// Test 2: Read it back
+	std::cout << "Test 2: Round Trip\n";
+	std::cout << "------------------\n";
+	{
+		Reading decoded;
+		sta_ref::utils::from_json(decoded, json);
+		std::cout << "sensor/value: " << decoded.sensor << "/" << decoded.value << " (expected 5/1.25)\n";
+		std::cout << "color is green: " << (decoded.color == Color::green) << " (1=true)\n";
+		std::cout << "samples: " << decoded.samples.size() << " (expected 2)\n";
+		std::cout << "escaped tags survive: " << (decoded.tags == reading.tags) << " (1=true)\n";
+	}
+	std::cout << "\n";
+
+	// Test 3: Base classes, maps and sets
+	std::cout << "Test 3: Base Classes, Maps and Sets\n";
+	std::cout << "-----------------------------------\n";
+	{
+		Student student("Ada", 36, 1815);
+		student.luckyNumbers = {7, 3};
+		student.scores = {{"math", 100}};
+		sta_ref::utils::JsonWriter writer;
+		sta_ref::utils::to_json(student, writer);
+		std::cout << writer.str() << "\n";
+
+		Student restored("", 0, 0);
+		sta_ref::utils::from_json(restored, writer.str());
+		std::cout << "Restored: " << restored.name << ", " << restored.age << ", id " << restored.studentID
+		          << ", math=" << restored.scores["math"] << ", lucky " << restored.luckyNumbers.size()
+		          << " (expected Ada, 36, id 1815, math=100, lucky 2)\n";
+	}
+	std::cout << "\n";
+
+	// Test 4: Key order, whitespace, unknown keys and \u escapes
+	std::cout << "Test 4: Lenient Input\n";
+	std::cout << "---------------------\n";
+	{
+		Reading decoded;
+		sta_ref::utils::from_json(decoded,
+			" { \"tags\" : [\"caf\\u00e9\"], \"extra\": {\"nested\": [1, 2, {}]},\n"
+			"   \"color\": \"blue\", \"sensor\": -3, \"value\": 2e3 } ");
+		std::cout << "sensor/value: " << decoded.sensor << "/" << decoded.value << " (expected -3/2000)\n";
+		std::cout << "color is blue: " << (decoded.color == Color::blue) << " (1=true)\n";
+		std::cout << "unicode tag bytes: " << decoded.tags[0].size() << " (expected 5)\n";
+	}
+	std::cout << "\n";
+
+	// Test 5: Malformed input
+	std::cout << "Test 5: Malformed Input\n";
+	std::cout << "-----------------------\n";
+	for (const char* bad : {"{\"sensor\": 1,", "{\"color\": \"purple\"}", "{\"sensor\": \"x\"}", "{} []"}) {
+		Reading decoded;
+		try {
+			sta_ref::utils::from_json(decoded, bad);
+			std::cout << "ERROR: accepted " << bad << "\n";
+		} catch (const std::runtime_error& e) {
+			std::cout << "Rejected: " << e.what() << "\n";
+		}
+	}
+	for (const char* bad : {"{\"level\": 300}", "{\"level\": -1}"}) {
+		Gauge gauge;
+		try {
+			sta_ref::utils::from_json(gauge, bad);
+			std::cout << "ERROR: accepted " << bad << " as " << int(gauge.level) << "\n";
+		} catch (const std::runtime_error& e) {
+			std::cout << "Rejected: " << e.what() << "\n";
+		}
+	}
+	Gauge gauge;
+	sta_ref::utils::from_json(gauge, "{\"level\": 255}");
+	std::cout << "uint8_t field at its limit: " << int(gauge.level) << " (expected 255)\n";
+	try {
+		Reading decoded;
+		sta_ref::utils::from_json(decoded, "{\"tags\": [\"line\nbreak\"]}");
+		std::cout << "ERROR: accepted a raw newline inside a string\n";
+	} catch (const std::runtime_error& e) {
+		std::cout << "Rejected: " << e.what() << "\n";
+	}
+	std::cout << "\n";
+
+	std::cout << "========== All JSON Serialization Tests Completed ==========\n";
+}
+
 int main() {
 	test_static_reflection();
 	test_dynamic_reflection();
@@ -1260,5 +2592,6 @@ int main() {
 	test_any_invoke();
 	test_container_operations();
 	test_static_variable_access();
+	test_json_serialization();
 	return 0;
 }
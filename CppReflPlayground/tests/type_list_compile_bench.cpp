@@ -0,0 +1,59 @@
+//
+// Created by qianq on 1/5/2026.
+//
+// Compile-time benchmark for type_list.h: instantiates every algorithm on a list of
+// TYPE_LIST_BENCH_SIZE distinct types. Built by the compile_bench target with -ftime-report,
+// whose TOTAL line gives instantiation time and peak compiler memory for each size.
+
+#include <cstddef>
+#include <utility>
+#include "../include/static_refl/type_list.h"
+
+#ifndef TYPE_LIST_BENCH_SIZE
+#define TYPE_LIST_BENCH_SIZE 64
+#endif
+
+namespace sta_ref = my_reflect::static_refl;
+
+template <std::size_t I>
+struct element {
+    static constexpr bool even = I % 2 == 0;
+};
+
+template <typename T>
+struct is_even_element {
+    static constexpr bool value = T::even;
+};
+
+template <typename>
+struct make_list;
+
+template <std::size_t... Is>
+struct make_list<std::index_sequence<Is...>> {
+    using type = sta_ref::type_list<element<Is>...>;
+};
+
+constexpr std::size_t N = TYPE_LIST_BENCH_SIZE;
+using List = typename make_list<std::make_index_sequence<N>>::type;
+
+// Every index of the list, as a reflection macro with N fields would do
+template <std::size_t... Is>
+constexpr bool check_every_index(std::index_sequence<Is...>) {
+    return (std::is_same_v<sta_ref::get_t<List, Is>, element<Is>> && ...);
+}
+static_assert(check_every_index(std::make_index_sequence<N>{}));
+
+static_assert(std::is_same_v<sta_ref::tail_t<List>, element<N - 1>>);
+static_assert(sta_ref::count_v<List, is_even_element> == static_cast<int>((N + 1) / 2));
+
+using Evens = sta_ref::filter_t<List, is_even_element>;
+static_assert(Evens::size == (N + 1) / 2);
+static_assert(std::is_same_v<sta_ref::tail_t<Evens>, element<(N - 1) / 2 * 2>>);
+
+using Reversed = sta_ref::reverse_t<List>;
+static_assert(std::is_same_v<sta_ref::head_t<Reversed>, element<N - 1>>);
+static_assert(std::is_same_v<sta_ref::tail_t<Reversed>, element<0>>);
+
+int main() {
+    return static_cast<int>(List::size != N);
+}